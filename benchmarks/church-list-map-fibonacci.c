@@ -0,0 +1,48 @@
+#define OPTISCOPE_TESTS_NO_MAIN
+#include "../tests.c"
+
+static struct lambda_term *
+church_map(void) {
+    struct lambda_term *g, *list, *f, *n, *x, *acc;
+
+    return lambda(
+        g,
+        lambda(
+            list,
+            lambda(
+                f,
+                lambda(
+                    n,
+                    apply(
+                        apply(
+                            var(list),
+                            lambda(
+                                x,
+                                lambda(
+                                    acc,
+                                    apply(
+                                        apply(var(f), apply(var(g), var(x))),
+                                        var(acc))))),
+                        var(n))))));
+}
+
+static struct lambda_term *
+generate_list(const uint64_t n) {
+    struct lambda_term *term = church_nil();
+    for (uint64_t i = 0; i < n; i++) {
+        term = apply(apply(church_cons(), cell(i)), term);
+    }
+
+    return term;
+}
+
+#define BENCHMARK_TERM                                                         \
+    apply(apply(church_map(), fix_fibonacci_term()), generate_list(12))
+
+int
+main(void) {
+    optiscope_open_pools();
+    // The list is under binders, so it is computed during full reduction.
+    optiscope_algorithm(stdout, BENCHMARK_TERM);
+    optiscope_close_pools();
+}
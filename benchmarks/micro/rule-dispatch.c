@@ -0,0 +1,416 @@
+// Streams a fixed sequence of synthetic active pairs through the rule table &
+// through the chains of comparisons it replaced. The rules themselves are
+// replaced by tiny handlers that fold the rule & the orientation of the pair
+// into a checksum, so that the time (& the branch mispredictions) measured are
+// those of dispatching alone. The two dispatchers must agree on every pair.
+//
+// Usage: ./rule-dispatch table|chain [<rounds>]
+// (See `./command/rule-dispatch.sh`.)
+
+#include "../../optiscope.c"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __GNUC__
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+// The number of active pairs in the stream, which is replayed `rounds` times.
+#define STREAM_LENGTH (UINT64_C(1) << 16)
+
+// Duplicators & delimiters are drawn from this many indices, so that some of
+// the pairs annihilate.
+#define INDEX_SPREAD 4
+
+#define DEFAULT_ROUNDS 2000
+
+struct bench {
+    uint64_t checksum;
+};
+
+// Everything the dispatchers can fire: the simple rules of `rule_table`, the
+// rules chosen by comparing duplicator (delimiter) indices, & the stop.
+// clang-format off
+#define BENCH_SIMPLE_RULES \
+    X(BETA) X(BETA_C) X(IDENTITY_BETA) X(GC_BETA) \
+    X(DO_UNARY_CALL) X(DO_BINARY_CALL) X(DO_BINARY_CALL_AUX) \
+        X(DO_IF_THEN_ELSE) X(DO_PERFORM) \
+    X(ANNIHILATE_DELIM_DELIM) X(COMMUTE) \
+    X(COMMUTE_ROOT_DELIM) X(COMMUTE_APPL_DELIM) X(COMMUTE_CELL_DELIM) \
+        X(COMMUTE_UCALL_DELIM) X(COMMUTE_BCALL_DELIM) \
+        X(COMMUTE_BCALL_AUX_DELIM) X(COMMUTE_ITE_DELIM) \
+    X(COMMUTE_APPL_DUP) X(COMMUTE_CELL_DUP) X(COMMUTE_UCALL_DUP) \
+        X(COMMUTE_BCALL_DUP) X(COMMUTE_BCALL_AUX_DUP) X(COMMUTE_ITE_DUP) \
+    X(COMMUTE_DUP_DELIM) \
+    X(COMMUTE_LAMBDA_DELIM) X(COMMUTE_IDENTITY_LAMBDA_DELIM) \
+        X(COMMUTE_GC_LAMBDA_DELIM) X(COMMUTE_LAMBDA_C_DELIM) \
+    X(COMMUTE_LAMBDA_DUP) X(COMMUTE_IDENTITY_LAMBDA_DUP) \
+        X(COMMUTE_GC_LAMBDA_DUP) X(COMMUTE_LAMBDA_C_DUP)
+#define BENCH_ALL_RULES \
+    BENCH_SIMPLE_RULES \
+    X(ANNIHILATE_DUP_DUP) X(COMMUTE_DUP_DUP) X(COMMUTE_DELIM_DELIM) X(STOP)
+// clang-format on
+
+enum bench_rule {
+#define X(rule) BENCH_RULE_##rule,
+    BENCH_ALL_RULES
+#undef X
+};
+
+// A separate function for each rule, so that the compiler cannot turn either
+// dispatcher into a lookup of the rule number.
+#define X(rule)                                                                \
+    BENCH_NOINLINE static void bench_##rule(                                   \
+        struct bench *const restrict b,                                        \
+        const struct node f,                                                   \
+        const struct node g) {                                                 \
+        (void)g;                                                               \
+        const uint64_t x = BENCH_RULE_##rule * UINT64_C(1024) + f.ports[-1];   \
+        b->checksum = (b->checksum ^ x) * UINT64_C(0x100000001b3);             \
+    }
+BENCH_ALL_RULES
+#undef X
+
+#define BETA                          bench_BETA
+#define BETA_C                        bench_BETA_C
+#define IDENTITY_BETA                 bench_IDENTITY_BETA
+#define GC_BETA                       bench_GC_BETA
+#define DO_UNARY_CALL                 bench_DO_UNARY_CALL
+#define DO_BINARY_CALL                bench_DO_BINARY_CALL
+#define DO_BINARY_CALL_AUX            bench_DO_BINARY_CALL_AUX
+#define DO_IF_THEN_ELSE               bench_DO_IF_THEN_ELSE
+#define DO_PERFORM                    bench_DO_PERFORM
+#define ANNIHILATE_DELIM_DELIM        bench_ANNIHILATE_DELIM_DELIM
+#define ANNIHILATE_DUP_DUP            bench_ANNIHILATE_DUP_DUP
+#define COMMUTE                       bench_COMMUTE
+#define COMMUTE_ROOT_DELIM            bench_COMMUTE_ROOT_DELIM
+#define COMMUTE_APPL_DELIM            bench_COMMUTE_APPL_DELIM
+#define COMMUTE_CELL_DELIM            bench_COMMUTE_CELL_DELIM
+#define COMMUTE_UCALL_DELIM           bench_COMMUTE_UCALL_DELIM
+#define COMMUTE_BCALL_DELIM           bench_COMMUTE_BCALL_DELIM
+#define COMMUTE_BCALL_AUX_DELIM       bench_COMMUTE_BCALL_AUX_DELIM
+#define COMMUTE_ITE_DELIM             bench_COMMUTE_ITE_DELIM
+#define COMMUTE_APPL_DUP              bench_COMMUTE_APPL_DUP
+#define COMMUTE_CELL_DUP              bench_COMMUTE_CELL_DUP
+#define COMMUTE_UCALL_DUP             bench_COMMUTE_UCALL_DUP
+#define COMMUTE_BCALL_DUP             bench_COMMUTE_BCALL_DUP
+#define COMMUTE_BCALL_AUX_DUP         bench_COMMUTE_BCALL_AUX_DUP
+#define COMMUTE_ITE_DUP               bench_COMMUTE_ITE_DUP
+#define COMMUTE_DUP_DELIM             bench_COMMUTE_DUP_DELIM
+#define COMMUTE_DELIM_DELIM           bench_COMMUTE_DELIM_DELIM
+#define COMMUTE_DUP_DUP               bench_COMMUTE_DUP_DUP
+#define COMMUTE_LAMBDA_DELIM          bench_COMMUTE_LAMBDA_DELIM
+#define COMMUTE_LAMBDA_DUP            bench_COMMUTE_LAMBDA_DUP
+#define COMMUTE_IDENTITY_LAMBDA_DELIM bench_COMMUTE_IDENTITY_LAMBDA_DELIM
+#define COMMUTE_IDENTITY_LAMBDA_DUP   bench_COMMUTE_IDENTITY_LAMBDA_DUP
+#define COMMUTE_GC_LAMBDA_DELIM       bench_COMMUTE_GC_LAMBDA_DELIM
+#define COMMUTE_GC_LAMBDA_DUP         bench_COMMUTE_GC_LAMBDA_DUP
+#define COMMUTE_LAMBDA_C_DELIM        bench_COMMUTE_LAMBDA_C_DELIM
+#define COMMUTE_LAMBDA_C_DUP          bench_COMMUTE_LAMBDA_C_DUP
+#define STOP                          bench_STOP
+
+// The same as `DISPATCH_ACTIVE_PAIR` in `optiscope.c`, except that the stop is
+// a handler as well.
+#define DISPATCH_BY_TABLE(graph, f, g)                                         \
+    do {                                                                       \
+        const uint64_t fsym = f.ports[-1], gsym = g.ports[-1];                 \
+                                                                               \
+        switch (rule_table[symbol_class(fsym)][symbol_class(gsym)]) {          \
+            BENCH_SIMPLE_RULES                                                 \
+        case RULE_DUP_DUP << 1:                                                \
+            if (fsym == gsym) ANNIHILATE_DUP_DUP(graph, f, g);                 \
+            else COMMUTE_DUP_DUP(graph, f, g);                                 \
+            break;                                                             \
+        case RULE_DELIM_DELIM << 1:                                            \
+            if (fsym == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);             \
+            else COMMUTE_DELIM_DELIM(graph, f, g);                             \
+            break;                                                             \
+        case RULE_STOP << 1: STOP(graph, f, g); break;                         \
+        default: COMPILER_UNREACHABLE();                                       \
+        }                                                                      \
+    } while (false)
+
+// The chains of comparisons that `rule_table` replaced, with the same change.
+#define DISPATCH_BY_CHAIN(graph, f, g)                                         \
+    do {                                                                       \
+        const uint64_t fsym = f.ports[-1], gsym = g.ports[-1];                 \
+                                                                               \
+        switch (fsym) {                                                        \
+        duplicator:                                                            \
+            if (fsym == gsym) ANNIHILATE_DUP_DUP(graph, f, g);                 \
+            else if (SYMBOL_APPLICATOR == gsym) COMMUTE_APPL_DUP(graph, g, f); \
+            else if (SYMBOL_LAMBDA == gsym) COMMUTE_LAMBDA_DUP(graph, g, f);   \
+            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
+                COMMUTE_IDENTITY_LAMBDA_DUP(graph, g, f);                      \
+            else if (SYMBOL_GC_LAMBDA == gsym)                                 \
+                COMMUTE_GC_LAMBDA_DUP(graph, g, f);                            \
+            else if (SYMBOL_LAMBDA_C == gsym)                                  \
+                COMMUTE_LAMBDA_C_DUP(graph, g, f);                             \
+            else if (SYMBOL_CELL == gsym) COMMUTE_CELL_DUP(graph, g, f);       \
+            else if (SYMBOL_UNARY_CALL == gsym)                                \
+                COMMUTE_UCALL_DUP(graph, g, f);                                \
+            else if (SYMBOL_BINARY_CALL == gsym)                               \
+                COMMUTE_BCALL_DUP(graph, g, f);                                \
+            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
+                COMMUTE_BCALL_AUX_DUP(graph, g, f);                            \
+            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
+                COMMUTE_ITE_DUP(graph, g, f);                                  \
+            else if (IS_DELIMITER(gsym)) COMMUTE_DUP_DELIM(graph, f, g);       \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_DUP_DUP(graph, f, g);        \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        delimiter:                                                             \
+            if (fsym == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);             \
+            else if (SYMBOL_ROOT == gsym) COMMUTE_ROOT_DELIM(graph, g, f);     \
+            else if (SYMBOL_APPLICATOR == gsym)                                \
+                COMMUTE_APPL_DELIM(graph, g, f);                               \
+            else if (SYMBOL_LAMBDA == gsym) COMMUTE_LAMBDA_DELIM(graph, g, f); \
+            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
+                COMMUTE_IDENTITY_LAMBDA_DELIM(graph, g, f);                    \
+            else if (SYMBOL_GC_LAMBDA == gsym)                                 \
+                COMMUTE_GC_LAMBDA_DELIM(graph, g, f);                          \
+            else if (SYMBOL_LAMBDA_C == gsym)                                  \
+                COMMUTE_LAMBDA_C_DELIM(graph, g, f);                           \
+            else if (SYMBOL_CELL == gsym) COMMUTE_CELL_DELIM(graph, g, f);     \
+            else if (SYMBOL_UNARY_CALL == gsym)                                \
+                COMMUTE_UCALL_DELIM(graph, g, f);                              \
+            else if (SYMBOL_BINARY_CALL == gsym)                               \
+                COMMUTE_BCALL_DELIM(graph, g, f);                              \
+            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
+                COMMUTE_BCALL_AUX_DELIM(graph, g, f);                          \
+            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
+                COMMUTE_ITE_DELIM(graph, g, f);                                \
+            else if (IS_DELIMITER(gsym)) COMMUTE_DELIM_DELIM(graph, f, g);     \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_DUP_DELIM(graph, g, f);      \
+            else COMMUTE(graph, g, f);                                         \
+            break;                                                             \
+        case SYMBOL_ROOT:                                                      \
+            if (IS_DELIMITER(gsym)) COMMUTE_ROOT_DELIM(graph, f, g);           \
+            else if (IS_ANY_LAMBDA(gsym) || SYMBOL_CELL == gsym)               \
+                STOP(graph, f, g);                                             \
+            else COMPILER_UNREACHABLE();                                       \
+            break;                                                             \
+        case SYMBOL_APPLICATOR:                                                \
+            if (SYMBOL_LAMBDA == gsym) BETA(graph, f, g);                      \
+            else if (SYMBOL_LAMBDA_C == gsym) BETA_C(graph, f, g);             \
+            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
+                IDENTITY_BETA(graph, f, g);                                    \
+            else if (SYMBOL_GC_LAMBDA == gsym) GC_BETA(graph, f, g);           \
+            else if (IS_DELIMITER(gsym)) COMMUTE_APPL_DELIM(graph, f, g);      \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_APPL_DUP(graph, f, g);       \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_LAMBDA:                                                    \
+            if (SYMBOL_APPLICATOR == gsym) BETA(graph, g, f);                  \
+            else if (IS_DELIMITER(gsym)) COMMUTE_LAMBDA_DELIM(graph, f, g);    \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_LAMBDA_DUP(graph, f, g);     \
+            else if (SYMBOL_ROOT == gsym) STOP(graph, f, g);                   \
+            else COMMUTE(graph, g, f);                                         \
+            break;                                                             \
+        case SYMBOL_IDENTITY_LAMBDA:                                           \
+            if (SYMBOL_APPLICATOR == gsym) IDENTITY_BETA(graph, g, f);         \
+            else if (IS_DELIMITER(gsym))                                       \
+                COMMUTE_IDENTITY_LAMBDA_DELIM(graph, f, g);                    \
+            else if (IS_DUPLICATOR(gsym))                                      \
+                COMMUTE_IDENTITY_LAMBDA_DUP(graph, f, g);                      \
+            else if (SYMBOL_ROOT == gsym) STOP(graph, f, g);                   \
+            else COMMUTE(graph, g, f);                                         \
+            break;                                                             \
+        case SYMBOL_GC_LAMBDA:                                                 \
+            if (SYMBOL_APPLICATOR == gsym) GC_BETA(graph, g, f);               \
+            else if (IS_DELIMITER(gsym)) COMMUTE_GC_LAMBDA_DELIM(graph, f, g); \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_GC_LAMBDA_DUP(graph, f, g);  \
+            else if (SYMBOL_ROOT == gsym) STOP(graph, f, g);                   \
+            else COMMUTE(graph, g, f);                                         \
+            break;                                                             \
+        case SYMBOL_LAMBDA_C:                                                  \
+            if (SYMBOL_APPLICATOR == gsym) BETA_C(graph, g, f);                \
+            else if (IS_DELIMITER(gsym)) COMMUTE_LAMBDA_C_DELIM(graph, f, g);  \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_LAMBDA_C_DUP(graph, f, g);   \
+            else if (SYMBOL_ROOT == gsym) STOP(graph, f, g);                   \
+            else COMMUTE(graph, g, f);                                         \
+            break;                                                             \
+        case SYMBOL_ERASER: COMMUTE(graph, f, g); break;                       \
+        case SYMBOL_S:                                                         \
+            if (SYMBOL_S == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);         \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_CELL:                                                      \
+            if (SYMBOL_UNARY_CALL == gsym) DO_UNARY_CALL(graph, g, f);         \
+            else if (SYMBOL_BINARY_CALL == gsym) DO_BINARY_CALL(graph, g, f);  \
+            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
+                DO_BINARY_CALL_AUX(graph, g, f);                               \
+            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
+                DO_IF_THEN_ELSE(graph, g, f);                                  \
+            else if (SYMBOL_PERFORM == gsym) DO_PERFORM(graph, g, f);          \
+            else if (IS_DELIMITER(gsym)) COMMUTE_CELL_DELIM(graph, f, g);      \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_CELL_DUP(graph, f, g);       \
+            else if (SYMBOL_ROOT == gsym) STOP(graph, f, g);                   \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_UNARY_CALL:                                                \
+            if (SYMBOL_CELL == gsym) DO_UNARY_CALL(graph, f, g);               \
+            else if (IS_DELIMITER(gsym)) COMMUTE_UCALL_DELIM(graph, f, g);     \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_UCALL_DUP(graph, f, g);      \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_BINARY_CALL:                                               \
+            if (SYMBOL_CELL == gsym) DO_BINARY_CALL(graph, f, g);              \
+            else if (IS_DELIMITER(gsym)) COMMUTE_BCALL_DELIM(graph, f, g);     \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_BCALL_DUP(graph, f, g);      \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_BINARY_CALL_AUX:                                           \
+            if (SYMBOL_CELL == gsym) DO_BINARY_CALL_AUX(graph, f, g);          \
+            else if (IS_DELIMITER(gsym)) COMMUTE_BCALL_AUX_DELIM(graph, f, g); \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_BCALL_AUX_DUP(graph, f, g);  \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_IF_THEN_ELSE:                                              \
+            if (SYMBOL_CELL == gsym) DO_IF_THEN_ELSE(graph, f, g);             \
+            else if (IS_DELIMITER(gsym)) COMMUTE_ITE_DELIM(graph, f, g);       \
+            else if (IS_DUPLICATOR(gsym)) COMMUTE_ITE_DUP(graph, f, g);        \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        case SYMBOL_PERFORM:                                                   \
+            if (SYMBOL_CELL == gsym) DO_PERFORM(graph, f, g);                  \
+            else COMMUTE(graph, f, g);                                         \
+            break;                                                             \
+        default:                                                               \
+            if (fsym <= MAX_DUPLICATOR_INDEX) goto duplicator;                 \
+            else if (fsym <= MAX_DELIMITER_INDEX) goto delimiter;              \
+            else COMPILER_UNREACHABLE();                                       \
+        }                                                                      \
+    } while (false)
+
+#define X(rule)                                                                \
+    case RULE_##rule << 1: rule(graph, f, g); break;                           \
+    case RULE_##rule << 1 | 1: rule(graph, g, f); break;
+
+BENCH_NOINLINE static void
+dispatch_by_table(
+    struct bench *const restrict graph,
+    const struct node *const restrict pairs,
+    const uint64_t npairs) {
+    for (uint64_t i = 0; i < npairs; i++) {
+        const struct node f = pairs[2 * i], g = pairs[2 * i + 1];
+        DISPATCH_BY_TABLE(graph, f, g);
+    }
+}
+
+#undef X
+
+BENCH_NOINLINE static void
+dispatch_by_chain(
+    struct bench *const restrict graph,
+    const struct node *const restrict pairs,
+    const uint64_t npairs) {
+    for (uint64_t i = 0; i < npairs; i++) {
+        const struct node f = pairs[2 * i], g = pairs[2 * i + 1];
+        DISPATCH_BY_CHAIN(graph, f, g);
+    }
+}
+
+// A representative symbol of the class `c`.
+static uint64_t
+symbol_of_class(const uint8_t c, uint64_t *const restrict seed) {
+    *seed ^= *seed << 13, *seed ^= *seed >> 7, *seed ^= *seed << 17;
+
+    const uint64_t i = *seed % INDEX_SPREAD;
+
+    switch (c) {
+    case SYMBOL_CLASS_DUPLICATOR: return SYMBOL_DUPLICATOR(i);
+    case SYMBOL_CLASS_DELIMITER: return SYMBOL_DELIMITER(i);
+    default: return c;
+    }
+}
+
+// Every pair of classes that the rule table does not rule out, except for the
+// unused symbols, which the chains of comparisons doe not handle.
+static uint64_t
+possible_class_pairs(uint8_t classes[const restrict][2]) {
+    uint64_t n = 0;
+
+    for (uint8_t f = 0; f < SYMBOL_CLASSES_COUNT; f++) {
+        for (uint8_t g = 0; g < SYMBOL_CLASSES_COUNT; g++) {
+            if (SYMBOL_UNUSED == f || SYMBOL_UNUSEDX == f ||
+                SYMBOL_UNUSED == g || SYMBOL_UNUSEDX == g ||
+                RULE_NONE == rule_table[f][g] >> 1) {
+                continue;
+            }
+            classes[n][0] = f, classes[n][1] = g, n++;
+        }
+    }
+
+    return n;
+}
+
+// Each node is a symbol followed by one port, which is where `ports` points.
+static struct node *
+build_stream(uint64_t *const restrict words, const uint64_t npairs) {
+    static uint8_t classes[SYMBOL_CLASSES_COUNT * SYMBOL_CLASSES_COUNT][2];
+    const uint64_t nclasses = possible_class_pairs(classes);
+    struct node *const pairs = malloc(sizeof pairs[0] * 2 * npairs);
+    uint64_t seed = UINT64_C(0x9e3779b97f4a7c15);
+
+    if (NULL == pairs) { return NULL; }
+
+    for (uint64_t i = 0; i < 2 * npairs; i += 2) {
+        seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17;
+        const uint8_t *const pair = classes[seed % nclasses];
+
+        words[2 * i] = symbol_of_class(pair[0], &seed);
+        words[2 * i + 2] = symbol_of_class(pair[1], &seed);
+        pairs[i].ports = &words[2 * i + 1];
+        pairs[i + 1].ports = &words[2 * i + 3];
+    }
+
+    return pairs;
+}
+
+int
+main(const int argc, const char *const argv[]) {
+    if (argc < 2 || (strcmp(argv[1], "table") && strcmp(argv[1], "chain"))) {
+        fprintf(stderr, "Usage: %s table|chain [<rounds>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const bool by_table = 0 == strcmp(argv[1], "table");
+    const long rounds = argc > 2 ? atol(argv[2]) : DEFAULT_ROUNDS;
+    uint64_t *const words = malloc(sizeof words[0] * 4 * STREAM_LENGTH);
+    struct node *const pairs =
+        NULL == words ? NULL : build_stream(words, STREAM_LENGTH);
+
+    if (NULL == pairs || rounds <= 0) {
+        fprintf(stderr, "Cannot set up the benchmark!\n");
+        return EXIT_FAILURE;
+    }
+
+    struct bench by_table_once = {0}, by_chain_once = {0};
+    dispatch_by_table(&by_table_once, pairs, STREAM_LENGTH);
+    dispatch_by_chain(&by_chain_once, pairs, STREAM_LENGTH);
+    if (by_table_once.checksum != by_chain_once.checksum) {
+        fprintf(stderr, "The dispatchers disagree!\n");
+        return EXIT_FAILURE;
+    }
+
+    struct bench b = {0};
+    const clock_t start = clock();
+    for (long i = 0; i < rounds; i++) {
+        if (by_table) dispatch_by_table(&b, pairs, STREAM_LENGTH);
+        else dispatch_by_chain(&b, pairs, STREAM_LENGTH);
+    }
+    const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    const uint64_t ndispatches = (uint64_t)rounds * STREAM_LENGTH;
+
+    printf("Dispatcher: %s\n", argv[1]);
+    printf("Total dispatches: %" PRIu64 "\n", ndispatches);
+    printf("Time per dispatch: %.3f ns\n", seconds * 1e9 / (double)ndispatches);
+    printf("Checksum: %016" PRIx64 "\n", b.checksum);
+
+    free(pairs), free(words);
+}
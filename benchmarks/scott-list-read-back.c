@@ -0,0 +1,31 @@
+#define OPTISCOPE_TESTS_NO_MAIN
+#include "../tests.c"
+
+// Build the list directly in normal form, for building it by `scott_cons`
+// would leave a redex under the binders of each tail.
+static struct lambda_term *
+generate_list(const uint64_t n) {
+    struct lambda_term *term = scott_nil();
+    for (uint64_t i = 0; i < n; i++) {
+        struct lambda_term *nil, *cons;
+        term = lambda(
+            nil, lambda(cons, apply(apply(var(cons), cell(i)), term)));
+    }
+
+    return term;
+}
+
+#define BENCHMARK_TERM apply(i_combinator(), generate_list(1000000))
+
+int
+main(void) {
+    const OptiscopeTermBuilder builder = optiscope_open_term_builder();
+    optiscope_use_term_builder(builder);
+    struct lambda_term *const term = BENCHMARK_TERM;
+    optiscope_use_term_builder(NULL);
+
+    optiscope_open_pools();
+    optiscope_algorithm(stdout, term);
+    optiscope_close_pools();
+    optiscope_close_term_builder(builder);
+}
@@ -0,0 +1,183 @@
+// The command-line driver: run a textual term (see `README.md` for the syntax)
+// read from a file or the standard input, & print its normal form.
+
+#include "optiscope.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The primitives
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+static uint64_t plus_one(const uint64_t x) { return x + 1; }
+
+static uint64_t minus_one(const uint64_t x) { return x - 1; }
+
+static uint64_t is_zero(const uint64_t x) { return 0 == x; }
+
+static uint64_t add(const uint64_t x, const uint64_t y) { return x + y; }
+
+static uint64_t subtract(const uint64_t x, const uint64_t y) { return x - y; }
+
+static uint64_t multiply(const uint64_t x, const uint64_t y) { return x * y; }
+
+// Division & remainder by zero give zero, so that no term can crash the driver.
+static uint64_t divide(const uint64_t x, const uint64_t y) {
+    return 0 == y ? 0 : x / y;
+}
+
+static uint64_t remainder_of(const uint64_t x, const uint64_t y) {
+    return 0 == y ? 0 : x % y;
+}
+
+static uint64_t equals(const uint64_t x, const uint64_t y) { return x == y; }
+
+static uint64_t not_equals(const uint64_t x, const uint64_t y) {
+    return x != y;
+}
+
+static uint64_t less_than(const uint64_t x, const uint64_t y) { return x < y; }
+
+static uint64_t less_than_or_equal(const uint64_t x, const uint64_t y) {
+    return x <= y;
+}
+
+static uint64_t greater_than(const uint64_t x, const uint64_t y) {
+    return x > y;
+}
+
+static uint64_t greater_than_or_equal(const uint64_t x, const uint64_t y) {
+    return x >= y;
+}
+
+static uint64_t (*const unary_functions[])(uint64_t) = {
+    plus_one,
+    minus_one,
+    is_zero,
+};
+
+static const char *const unary_names[] = {
+    "plus_one",
+    "minus_one",
+    "is_zero",
+};
+
+static uint64_t (*const binary_functions[])(uint64_t, uint64_t) = {
+    add,
+    subtract,
+    multiply,
+    divide,
+    remainder_of,
+    equals,
+    not_equals,
+    less_than,
+    less_than_or_equal,
+    greater_than,
+    greater_than_or_equal,
+};
+
+static const char *const binary_names[] = {
+    "add",
+    "subtract",
+    "multiply",
+    "divide",
+    "remainder",
+    "equals",
+    "not_equals",
+    "less_than",
+    "less_than_or_equal",
+    "greater_than",
+    "greater_than_or_equal",
+};
+
+static const struct optiscope_registry registry = {
+    .unary_functions = unary_functions,
+    .nunary_functions = sizeof unary_functions / sizeof unary_functions[0],
+    .binary_functions = binary_functions,
+    .nbinary_functions = sizeof binary_functions / sizeof binary_functions[0],
+    .unary_names = unary_names,
+    .binary_names = binary_names,
+};
+
+// The driver
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+static void
+usage(const char program[const restrict]) {
+    fprintf(
+        stderr,
+        "Usage: %s [-n] [-m <bytes>] [-t <milliseconds>] [<file>]\n"
+        "Reduce the textual term in <file> (or the standard input, if omitted "
+        "or `-`).\n"
+        "  -n  Doe not read back the normal form.\n"
+        "  -m  Limit the memory held by the graph nodes.\n"
+        "  -t  Limit the reduction time.\n",
+        program);
+    exit(EXIT_FAILURE);
+}
+
+static uint64_t
+parse_number(const char program[const restrict], const char *const string) {
+    if (NULL == string) { usage(program); }
+
+    char *end;
+    const unsigned long long value = strtoull(string, &end, 10);
+    if ('\0' == string[0] || '\0' != *end) { usage(program); }
+
+    return (uint64_t)value;
+}
+
+int
+main(int argc, char *argv[]) {
+    bool read_back = true;
+    uint64_t nbytes = 0, milliseconds = 0;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (0 == strcmp(argv[i], "-n")) {
+            read_back = false;
+        } else if (0 == strcmp(argv[i], "-m")) {
+            nbytes = parse_number(argv[0], argv[++i]);
+        } else if (0 == strcmp(argv[i], "-t")) {
+            milliseconds = parse_number(argv[0], argv[++i]);
+        } else if (NULL == path && ('-' != argv[i][0] || '\0' == argv[i][1])) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    FILE *const input =
+        NULL == path || 0 == strcmp(path, "-") ? stdin : fopen(path, "r");
+    if (NULL == input) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+
+    optiscope_open_pools();
+    optiscope_set_memory_limit((size_t)nbytes);
+    optiscope_set_timeout(milliseconds);
+    const enum optiscope_status status = optiscope_algorithm(
+        read_back ? stdout : NULL, optiscope_parse_term(input, &registry));
+    optiscope_close_pools();
+
+    if (stdin != input && 0 != fclose(input)) { perror("fclose"); }
+
+    switch (status) {
+    case OPTISCOPE_DONE:
+        if (read_back) { puts(""); }
+        return EXIT_SUCCESS;
+    case OPTISCOPE_OUT_OF_MEMORY:
+        fputs("The memory limit has been exceeded.\n", stderr);
+        break;
+    case OPTISCOPE_TIMED_OUT:
+        fputs("The timeout has expired.\n", stderr);
+        break;
+    case OPTISCOPE_SYNTAX_ERROR: break; // already reported
+    default: fprintf(stderr, "The reduction has failed (%d).\n", status);
+    }
+
+    return EXIT_FAILURE;
+}
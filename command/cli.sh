@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Build the command-line driver `cli.c` as `./optiscope-cli`; the arguments are
+# passed to the compiler (e.g., `-DOPTISCOPE_ENABLE_STATS`).
+
+set -e
+
+optiscope_options="-DNDEBUG -DOPTISCOPE_ENABLE_HUGE_PAGES"
+compiler_options="-Wall -Wextra -std=gnu99 -O3 -funroll-loops -march=native -Wno-unused-function"
+all_options="$optiscope_options $compiler_options"
+
+if [ -z $CC ]; then
+    CC=gcc
+fi
+
+$CC cli.c optiscope.c -o optiscope-cli $all_options "$@"
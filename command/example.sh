@@ -9,6 +9,10 @@ if [[ "$OSTYPE" == "darwin"* ]]; then
     options="$options $macos_suppress_options"
 fi
 
+# Extra compiler options can be passed in `$EXTRA_OPTIONS`, e.g.,
+# `EXTRA_OPTIONS=-pthread` for `parallel-runtimes`.
+options="$options $EXTRA_OPTIONS"
+
 gcc "examples/$1.c" optiscope.c -o "$1" $options
 ./"$1"
 rm "$1"
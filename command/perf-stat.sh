@@ -0,0 +1,39 @@
+#!/bin/bash
+
+set -e
+
+# Report last-level cache misses (or another `perf` event given in `$EVENT`,
+# e.g., `branch-misses`) per interaction (requires Linux `perf`).
+# Usage: ./command/perf-stat.sh [<benchmark-name>...]
+# Extra compiler options can be passed in `$EXTRA_OPTIONS`, e.g.,
+# `EXTRA_OPTIONS=-DOPTISCOPE_PREFETCH_DISTANCE=0` to disable prefetching.
+
+optiscope_options="-DNDEBUG -DOPTISCOPE_ENABLE_HUGE_PAGES -DOPTISCOPE_ENABLE_STATS"
+compiler_options="-Wall -Wextra -std=gnu99 -O3 -funroll-loops -march=native -Wno-unused-function"
+all_options="$optiscope_options $compiler_options $EXTRA_OPTIONS"
+
+if [ -z $CC ]; then
+    CC=gcc
+fi
+
+if [ -z $EVENT ]; then
+    EVENT=LLC-load-misses
+fi
+
+if [ $# -eq 0 ]; then
+    set -- fibonacci-of-30 scott-insertion-sort
+fi
+
+for base_filename in "$@"; do
+    $CC "benchmarks/$base_filename.c" optiscope.c -o "$base_filename" $all_options
+    perf stat -x, -e "$EVENT" -o "$base_filename.perf" \
+        ./"$base_filename" >"$base_filename.out"
+
+    count=$(grep "$EVENT" "$base_filename.perf" | cut -d, -f1)
+    interactions=$(grep "Total interactions:" "$base_filename.out" | cut -d' ' -f3)
+
+    echo "$base_filename: $count $EVENT, $interactions interactions," \
+        "$(awk "BEGIN { printf \"%.3f\", $count / $interactions }") per interaction"
+
+    rm "$base_filename" "$base_filename.perf" "$base_filename.out"
+done
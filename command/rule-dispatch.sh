@@ -0,0 +1,49 @@
+#!/bin/bash
+
+set -e
+
+# Stream a fixed sequence of synthetic active pairs through the rule table & the
+# chains of comparisons it replaced (see `benchmarks/micro/rule-dispatch.c`),
+# reporting the time & branch mispredictions (or another `perf` event given in
+# `$EVENT`) per dispatch. Without Linux `perf`, onely the time is reported.
+# Usage: ./command/rule-dispatch.sh [<rounds>]
+
+optiscope_options="-DNDEBUG"
+compiler_options="-Wall -Wextra -std=gnu99 -O3 -funroll-loops -march=native -Wno-unused-function"
+all_options="$optiscope_options $compiler_options $EXTRA_OPTIONS"
+
+if [ -z $CC ]; then
+    CC=gcc
+fi
+
+if [ -z $EVENT ]; then
+    EVENT=branch-misses
+fi
+
+$CC benchmarks/micro/rule-dispatch.c -o rule-dispatch $all_options
+
+if perf stat -e "$EVENT" true >/dev/null 2>&1; then
+    have_perf=true
+else
+    have_perf=false
+    echo "\`perf\` cannot count $EVENT here; reporting the time onely."
+fi
+
+for dispatcher in chain table; do
+    if $have_perf; then
+        perf stat -x, -e "$EVENT" -o rule-dispatch.perf \
+            ./rule-dispatch $dispatcher $1 >rule-dispatch.out
+
+        count=$(grep "$EVENT" rule-dispatch.perf | cut -d, -f1)
+        dispatches=$(grep "Total dispatches:" rule-dispatch.out | cut -d' ' -f3)
+
+        echo "$dispatcher: $(grep "Time per dispatch:" rule-dispatch.out)," \
+            "$(awk "BEGIN { printf \"%.4f\", $count / $dispatches }") $EVENT per dispatch"
+        rm rule-dispatch.perf
+    else
+        ./rule-dispatch $dispatcher $1 >rule-dispatch.out
+        echo "$dispatcher: $(grep "Time per dispatch:" rule-dispatch.out)"
+    fi
+done
+
+rm rule-dispatch rule-dispatch.out
@@ -21,6 +21,10 @@ fi
 # Detect potential fallback linked list bugs.
 options="$options -DOPTISCOPE_MULTIFOCUS_COUNT=1000"
 
+# Extra compiler options can be passed in `$EXTRA_OPTIONS`, e.g.,
+# `EXTRA_OPTIONS=-DOPTISCOPE_ENABLE_THREADED_CODE` to test the threaded code.
+options="$options $EXTRA_OPTIONS"
+
 $CC tests.c optiscope.c -o tests $options
 ./tests
 rm tests
@@ -0,0 +1,90 @@
+#include "../optiscope.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+// clang-format off
+static uint64_t is_zero(const uint64_t x) { return 0 == x; }
+
+static uint64_t is_one(const uint64_t x) { return 1 == x; }
+
+static uint64_t add(const uint64_t x, const uint64_t y)
+    { return x + y; }
+
+static uint64_t subtract(const uint64_t x, const uint64_t y)
+    { return x - y; }
+// clang-format on
+
+static struct lambda_term *
+fix_fibonacci_function(void) {
+    struct lambda_term *rec, *n;
+
+    return lambda(
+        rec,
+        lambda(
+            n,
+            if_then_else(
+                unary_call(is_zero, var(n)),
+                cell(0),
+                if_then_else(
+                    unary_call(is_one, var(n)),
+                    cell(1),
+                    binary_call(
+                        add,
+                        apply(var(rec), binary_call(subtract, var(n), cell(1))),
+                        apply(
+                            var(rec),
+                            binary_call(subtract, var(n), cell(2))))))));
+}
+
+#define NTHREADS 4
+
+struct job {
+    uint64_t n;
+    char result[64];
+};
+
+static void *
+run_job(void *const arg) {
+    struct job *const job = arg;
+
+    // Each thread owns its runtime, so no synchronization is needed.
+    const OptiscopeRuntime runtime = optiscope_open_runtime();
+
+    FILE *const fp = tmpfile();
+    if (NULL == fp) {
+        perror("tmpfile");
+        exit(EXIT_FAILURE);
+    }
+
+    optiscope_algorithm_r(
+        runtime, fp, apply(fix(fix_fibonacci_function()), cell(job->n)));
+    optiscope_close_runtime(runtime);
+
+    rewind(fp);
+    if (NULL == fgets(job->result, sizeof job->result, fp)) {
+        job->result[0] = '\0';
+    }
+    fclose(fp);
+
+    return NULL;
+}
+
+int
+main(void) {
+    pthread_t threads[NTHREADS];
+    struct job jobs[NTHREADS];
+
+    for (int i = 0; i < NTHREADS; i++) {
+        jobs[i].n = 15 + (uint64_t)i;
+        if (0 != pthread_create(&threads[i], NULL, run_job, &jobs[i])) {
+            perror("pthread_create");
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (int i = 0; i < NTHREADS; i++) {
+        pthread_join(threads[i], NULL);
+        printf("fib(%d) = %s\n", 15 + i, jobs[i].result);
+    }
+}
@@ -37,6 +37,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #include <inttypes.h>
 #include <limits.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -44,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 // Miscellaneous macros
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
@@ -89,9 +91,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef __GNUC__
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
+// GNU C "labels as values", for the threaded weak reduction loop.
+#if defined(__GNUC__) && defined(OPTISCOPE_ENABLE_THREADED_CODE)
+#define COMPILER_LABELS_AS_VALUES
+#endif
+
 // Perhaps for future use...
 #if defined(_OPENMP) && defined(NDEBUG)
 #include <omp.h>
@@ -120,6 +128,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define COMPILER_ALWAYS_INLINE      __attribute__((always_inline))
 #define COMPILER_RETURNS_NONNULL    __attribute__((returns_nonnull))
 #define COMPILER_WARN_UNUSED_RESULT __attribute__((warn_unused_result))
+#define COMPILER_PREFETCH(address)  __builtin_prefetch((address))
+
+#define COMPILER_THREAD_LOCAL       __thread
+
+#define COMPILER_ATOMIC_LOAD(object) __atomic_load_n((object), __ATOMIC_RELAXED)
+#define COMPILER_ATOMIC_STORE(object, value)                                   \
+    __atomic_store_n((object), (value), __ATOMIC_RELAXED)
 
 #ifndef __clang__
 
@@ -203,6 +218,26 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define COMPILER_FORMAT COMPILER_IGNORE_WITH_ARGS
 #endif
 
+#ifndef COMPILER_PREFETCH
+#define COMPILER_PREFETCH COMPILER_IGNORE_WITH_ARGS
+#endif
+
+#ifndef COMPILER_THREAD_LOCAL
+#if STANDARD_C11_OR_HIGHER
+#define COMPILER_THREAD_LOCAL _Thread_local
+#else
+#define COMPILER_THREAD_LOCAL COMPILER_IGNORE
+#endif
+#endif
+
+#ifndef COMPILER_ATOMIC_LOAD
+#define COMPILER_ATOMIC_LOAD(object) (*(object))
+#endif
+
+#ifndef COMPILER_ATOMIC_STORE
+#define COMPILER_ATOMIC_STORE(object, value) (*(object) = (value))
+#endif
+
 #ifndef COMPILER_UNREACHABLE
 #define COMPILER_UNREACHABLE COMPILER_IGNORE_WITH_ARGS
 #endif
@@ -428,6 +463,38 @@ ports_count(const uint64_t symbol) {
     }
 }
 
+// The number of 64-bit words occupied by a node, including the symbol, the
+// ports, & the additional data elements (function pointers, cell values,
+// delimiter & scope counts).
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT COMPILER_HOT //
+static uint8_t
+node_words(const uint64_t symbol) {
+    switch (symbol) {
+    case SYMBOL_ERASER:
+    case SYMBOL_IDENTITY_LAMBDA: //
+        return 2;
+    case SYMBOL_CELL:
+    case SYMBOL_GC_LAMBDA: //
+        return 3;
+    case SYMBOL_S:
+    case SYMBOL_APPLICATOR:
+    case SYMBOL_LAMBDA:
+    case SYMBOL_UNARY_CALL:
+    case SYMBOL_PERFORM:
+    case SYMBOL_LAMBDA_C:
+    duplicator_or_delimiter:
+        return 4;
+    case SYMBOL_BINARY_CALL:
+    case SYMBOL_BINARY_CALL_AUX:
+    case SYMBOL_IF_THEN_ELSE: //
+        return 5;
+    default:
+        if (IS_DUPLICATOR(symbol) || IS_DELIMITER(symbol))
+            goto duplicator_or_delimiter;
+        else COMPILER_UNREACHABLE();
+    }
+}
+
 COMPILER_PURE COMPILER_WARN_UNUSED_RESULT COMPILER_RETURNS_NONNULL
 COMPILER_NONNULL(1) COMPILER_HOT COMPILER_ALWAYS_INLINE //
 inline static uint64_t *
@@ -540,7 +607,6 @@ bump_index(const uint64_t symbol, const uint64_t offset) {
 }
 
 #define PHASE_REDUCE_WEAKLY UINT64_C(0)
-#define PHASE_DISCOVER      UINT64_C(1)
 #define PHASE_REDUCE_FULLY  UINT64_C(2)
 #define PHASE_UNWIND        UINT64_C(3)
 #define PHASE_SCOPE_REMOVE  UINT64_C(4)
@@ -548,6 +614,25 @@ bump_index(const uint64_t symbol, const uint64_t offset) {
 #define PHASE_GC            UINT64_C(6)
 #define PHASE_GC_AUX        UINT64_C(7)
 
+// Marks the principal port of a node that has been relocated by compaction.
+#define PHASE_FORWARDED UINT64_C(8)
+
+// The number of phase values left for marking the nodes visited by graph walks
+// (see `walk_graph`): all but `PHASE_REDUCE_WEAKLY`, `PHASE_GC`,
+// `PHASE_GC_AUX`, & `PHASE_FORWARDED`.
+#define NWALK_MARKS UINT64_C(12)
+
+// The mark of the walk number `epoch`; the weak reduction phase is the epoch 0.
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT //
+inline static uint64_t
+epoch_mark(const uint64_t epoch) {
+    if (0 == epoch) { return PHASE_REDUCE_WEAKLY; }
+
+    const uint64_t mark = UINT64_C(1) + (epoch - UINT64_C(1)) % NWALK_MARKS;
+
+    return mark < PHASE_GC ? mark : mark + (PHASE_FORWARDED - PHASE_GC + 1);
+}
+
 COMPILER_NONNULL(1) COMPILER_HOT COMPILER_ALWAYS_INLINE //
 inline static void
 set_phase(uint64_t *const restrict port, const uint64_t phase) {
@@ -601,44 +686,154 @@ xcalloc(const size_t n, const size_t size) {
     return object;
 }
 
+// The kinds of memory pages a chunk can be backed by, from the most to the
+// least preferred.
+enum page_tier {
+    PAGE_TIER_HUGETLB,     // explicit 2MB huge pages (`MAP_HUGETLB`)
+    PAGE_TIER_TRANSPARENT, // a 2MB-aligned mapping advised as `MADV_HUGEPAGE`
+    PAGE_TIER_REGULAR,     // whatever `malloc` gives us
+    PAGE_TIER_NONE,        // no chunk list has been obtained (statistics onely)
+};
+
+// The per-runtime accounting of the memory held by pools & multifocuses.
+struct memory_source {
+    // The best tier that still works, so that a tier that has failed once is
+    // not retried for every chunk.
+    enum page_tier tier;
+
+    // The number of bytes currently held & the maximum allowed (zero if
+    // unlimited).
+    size_t nbytes, limit;
+
+    // Where to escape from the current reduction if it is abandoned (because
+    // the limit is exceeded, or for any other reason); `longjmp` is given the
+    // status to return.
+    jmp_buf *escape;
+
+    // Whether exceeding the limit is onely recorded in `exceeded` instead of
+    // escaping, for the code that must release its own memory first (see
+    // `interrupt_translation`).
+    bool deferred, exceeded;
+};
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+reserve_memory(
+    struct memory_source *const restrict source, const size_t nbytes) {
+    MY_ASSERT(source);
+
+    if (source->limit > 0 && source->nbytes + nbytes > source->limit) {
+        if (source->deferred) {
+            source->exceeded = true;
+        } else if (source->escape) {
+            longjmp(*source->escape, OPTISCOPE_OUT_OF_MEMORY);
+        } else {
+            panic("The memory limit of %zu bytes is exceeded!", source->limit);
+        }
+    }
+
+    source->nbytes += nbytes;
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+release_memory(
+    struct memory_source *const restrict source, const size_t nbytes) {
+    MY_ASSERT(source);
+    XASSERT(source->nbytes >= nbytes);
+
+    source->nbytes -= nbytes;
+}
+
 #if defined(OPTISCOPE_ENABLE_HUGE_PAGES) && defined(__linux__)
 
 #define HUGE_PAGE_SIZE_2MB (2 * 1024 * 1024)
 
 #define POOL_CHUNK_LIST_SIZE(chunk_size) (HUGE_PAGE_SIZE_2MB / (chunk_size))
 
-COMPILER_NONNULL(1) COMPILER_COLD //
-void
-free_chunk(void *const memory);
+#define INITIAL_PAGE_TIER PAGE_TIER_HUGETLB
 
-// clang-format off
-COMPILER_WARN_UNUSED_RESULT COMPILER_MALLOC(free_chunk, 1) COMPILER_COLD
-// clang-format on
+COMPILER_WARN_UNUSED_RESULT COMPILER_COLD //
 static void *
-alloc_chunk(const size_t size) {
-    MY_ASSERT(size <= HUGE_PAGE_SIZE_2MB);
-
+map_aligned_huge_page(void) {
     const int prot = PROT_READ | PROT_WRITE,
-              flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
-    void *const memory = mmap(NULL, HUGE_PAGE_SIZE_2MB, prot, flags, -1, 0);
-    if (MAP_FAILED == memory) {
-        // Cannot allocate memory, defaulting to `xmalloc`.
-        perror("mmap");
-        return xmalloc(size);
-    }
+              flags = MAP_PRIVATE | MAP_ANONYMOUS;
 
-    return memory;
+    // Over-allocate twice the size to find a 2MB-aligned region inside.
+    const size_t size = 2 * HUGE_PAGE_SIZE_2MB;
+    char *const memory = mmap(NULL, size, prot, flags, -1, 0);
+    if (MAP_FAILED == memory) { return NULL; }
+
+    const uintptr_t address = (uintptr_t)memory;
+    const uintptr_t aligned =
+        (address + HUGE_PAGE_SIZE_2MB - 1) &
+        ~(uintptr_t)(HUGE_PAGE_SIZE_2MB - 1);
+    const size_t head = aligned - address,
+                 tail = size - head - HUGE_PAGE_SIZE_2MB;
+
+    if (head > 0) { munmap(memory, head); }
+    if (tail > 0) { munmap(memory + head + HUGE_PAGE_SIZE_2MB, tail); }
+
+    return memory + head;
+}
+
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 3)
+COMPILER_COLD //
+static void *
+alloc_chunk(
+    struct memory_source *const restrict source,
+    const size_t size,
+    enum page_tier *const restrict tier) {
+    MY_ASSERT(source);
+    MY_ASSERT(size <= HUGE_PAGE_SIZE_2MB);
+    MY_ASSERT(tier);
+
+    const int prot = PROT_READ | PROT_WRITE;
+
+    switch (source->tier) {
+    case PAGE_TIER_HUGETLB: {
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+        void *const memory =
+            mmap(NULL, HUGE_PAGE_SIZE_2MB, prot, flags, -1, 0);
+        if (MAP_FAILED != memory) {
+            *tier = PAGE_TIER_HUGETLB;
+            return memory;
+        }
+        // No huge pages are reserved (or left) in the system.
+        source->tier = PAGE_TIER_TRANSPARENT;
+    }
+        // fallthrough
+    case PAGE_TIER_TRANSPARENT: {
+        void *const memory = map_aligned_huge_page();
+        if (memory) {
+            *tier = PAGE_TIER_TRANSPARENT;
+#ifdef MADV_HUGEPAGE
+            if (0 == madvise(memory, HUGE_PAGE_SIZE_2MB, MADV_HUGEPAGE)) {
+                return memory;
+            }
+#endif
+            // Transparent huge pages are unavailable, but the mapping is
+            // still perfectly usable.
+            source->tier = PAGE_TIER_REGULAR;
+            return memory;
+        }
+        source->tier = PAGE_TIER_REGULAR;
+    }
+        // fallthrough
+    case PAGE_TIER_REGULAR: *tier = PAGE_TIER_REGULAR; return xmalloc(size);
+    default: COMPILER_UNREACHABLE();
+    }
 }
 
 COMPILER_NONNULL(1) COMPILER_COLD //
-void
-free_chunk(void *const memory) {
+static void
+free_chunk(void *const memory, const enum page_tier tier) {
     MY_ASSERT(memory);
 
-    if (munmap(memory, HUGE_PAGE_SIZE_2MB) < 0) {
-        // `munmap` failed, defaulting to `free`.
-        perror("munmap");
+    if (PAGE_TIER_REGULAR == tier) {
         free(memory);
+    } else if (munmap(memory, HUGE_PAGE_SIZE_2MB) < 0) {
+        perror("munmap");
     }
 }
 
@@ -646,11 +841,32 @@ free_chunk(void *const memory) {
 
 #define POOL_CHUNK_LIST_SIZE(chunk_size) 1024
 
-#define alloc_chunk xmalloc
-#define free_chunk  free
+#define INITIAL_PAGE_TIER PAGE_TIER_REGULAR
+
+#define alloc_chunk(source, size, tier)                                        \
+    ((void)(source), *(tier) = PAGE_TIER_REGULAR, xmalloc(size))
+#define free_chunk(memory, tier) ((void)(tier), free(memory))
+
+#endif
+
+// The first chunk list of a pool is made small & backed by regular pages, so
+// that tiny reductions doe not pay for mapping full-sized chunk lists.
+#define POOL_INITIAL_CHUNK_LIST_SIZE(chunk_size) (4096 / (chunk_size))
 
+// By default, recycled objects are preferred, which keepes the pools small; the
+// bump-first policy prefers the rest of the current chunk instead, so that the
+// nodes spawned together stay together.
+#ifdef OPTISCOPE_ENABLE_BUMP_FIRST
+#define POOL_BUMP_FIRST true
+#else
+#define POOL_BUMP_FIRST false
 #endif
 
+// Each pool hands out objects from two sources: the free list of recycled
+// objects, & the bump pointer running through the chunks in the order of their
+// allocation. Rewinding the bump pointer to the very first chunk returns all
+// the objects to the pool at once, without touching any of them. No memory is
+// allocated until the first object is requested.
 #define POOL_ALLOCATOR(prefix, chunk_size)                                     \
     union prefix##_chunk {                                                     \
         char data[chunk_size];                                                 \
@@ -659,77 +875,137 @@ free_chunk(void *const memory) {
                                                                                \
     struct prefix##_chunks_bucket {                                            \
         union prefix##_chunk *chunks;                                          \
+        size_t count;                                                          \
+        enum page_tier tier;                                                   \
         struct prefix##_chunks_bucket *next;                                   \
     };                                                                         \
                                                                                \
     struct prefix##_pool {                                                     \
         union prefix##_chunk *next_free_chunk;                                 \
-        struct prefix##_chunks_bucket *buckets;                                \
+        union prefix##_chunk *bump, *bump_end;                                 \
+        struct prefix##_chunks_bucket *buckets, *current_bucket;               \
+        struct memory_source *source;                                          \
     };                                                                         \
                                                                                \
-    COMPILER_NONNULL(1) COMPILER_COLD /* */                                    \
-    static void                                                                \
-    prefix##_pool_close(struct prefix##_pool *const restrict self);            \
-                                                                               \
-    COMPILER_MALLOC(prefix##_pool_close, 1) COMPILER_RETURNS_NONNULL           \
-    COMPILER_WARN_UNUSED_RESULT COMPILER_COLD /* */                            \
-    static struct prefix##_pool *                                              \
-    prefix##_pool_create(void) {                                               \
-        struct prefix##_pool *const self = xmalloc(sizeof *self);              \
-                                                                               \
-        union prefix##_chunk *chunks =                                         \
-            alloc_chunk(POOL_CHUNK_LIST_SIZE(chunk_size) * chunk_size);        \
-        for (size_t i = 0; i < POOL_CHUNK_LIST_SIZE(chunk_size) - 1; i++) {    \
-            chunks[i].next = &chunks[i + 1];                                   \
+    COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1)   \
+    COMPILER_COLD /* */                                                        \
+    static struct prefix##_chunks_bucket *                                     \
+    prefix##_pool_alloc_bucket(                                                \
+        struct memory_source *const restrict source, const size_t count) {     \
+        reserve_memory(source, count * chunk_size);                            \
+        struct prefix##_chunks_bucket *const bucket = xmalloc(sizeof *bucket); \
+        if (count < POOL_CHUNK_LIST_SIZE(chunk_size)) {                        \
+            bucket->chunks = xmalloc(count * chunk_size);                      \
+            bucket->tier = PAGE_TIER_REGULAR;                                  \
+        } else {                                                               \
+            bucket->chunks = alloc_chunk(                                      \
+                source,                                                        \
+                POOL_CHUNK_LIST_SIZE(chunk_size) * chunk_size,                 \
+                &bucket->tier);                                                \
         }                                                                      \
-        chunks[POOL_CHUNK_LIST_SIZE(chunk_size) - 1].next = NULL;              \
-        self->next_free_chunk = chunks;                                        \
+        bucket->count = count;                                                 \
+        bucket->next = NULL;                                                   \
+                                                                               \
+        return bucket;                                                         \
+    }                                                                          \
                                                                                \
-        struct prefix##_chunks_bucket *const buckets =                         \
-            xmalloc(sizeof buckets[0]);                                        \
-        buckets->chunks = chunks, buckets->next = NULL;                        \
-        self->buckets = buckets;                                               \
+    COMPILER_NONNULL(1, 2) COMPILER_COLD /* */                                 \
+    static void                                                                \
+    prefix##_pool_enter_bucket(                                                \
+        struct prefix##_pool *const restrict self,                             \
+        struct prefix##_chunks_bucket *const restrict bucket) {                \
+        self->current_bucket = bucket;                                         \
+        self->bump = bucket->chunks;                                           \
+        self->bump_end = bucket->chunks + bucket->count;                       \
+    }                                                                          \
                                                                                \
-        return self;                                                           \
+    COMPILER_NONNULL(1, 2) COMPILER_COLD /* */                                 \
+    static void                                                                \
+    prefix##_pool_open(                                                        \
+        struct prefix##_pool *const restrict self,                             \
+        struct memory_source *const restrict source) {                         \
+        self->next_free_chunk = NULL;                                          \
+        self->bump = self->bump_end = NULL;                                    \
+        self->buckets = self->current_bucket = NULL;                           \
+        self->source = source;                                                 \
     }                                                                          \
                                                                                \
     COMPILER_NONNULL(1) COMPILER_COLD /* */                                    \
     static void                                                                \
     prefix##_pool_close(struct prefix##_pool *const restrict self) {           \
         MY_ASSERT(self);                                                       \
-        XASSERT(self->buckets);                                                \
                                                                                \
         struct prefix##_chunks_bucket *iter = self->buckets;                   \
         while (iter) {                                                         \
             struct prefix##_chunks_bucket *next = iter->next;                  \
             XASSERT(iter->chunks);                                             \
-            free_chunk(iter->chunks);                                          \
+            if (iter->count < POOL_CHUNK_LIST_SIZE(chunk_size)) {              \
+                free(iter->chunks);                                            \
+            } else {                                                           \
+                free_chunk(iter->chunks, iter->tier);                          \
+            }                                                                  \
+            release_memory(self->source, iter->count * chunk_size);            \
             free(iter);                                                        \
             iter = next;                                                       \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    /* Return all the objects to the pool in time proportional to the number   \
+     * of buckets, not objects. */                                             \
+    COMPILER_NONNULL(1) COMPILER_COLD /* */                                    \
+    static void                                                                \
+    prefix##_pool_reset(struct prefix##_pool *const restrict self) {           \
+        MY_ASSERT(self);                                                       \
+                                                                               \
+        /* The free list may hold objects carved out of other pools. */        \
+        self->next_free_chunk = NULL;                                          \
+        if (NULL == self->buckets) { return; }                                 \
+                                                                               \
+        for (struct prefix##_chunks_bucket *iter = self->buckets;              \
+             iter != self->current_bucket->next;                               \
+             iter = iter->next) {                                              \
+            COMPILER_POISON_MEMORY(iter->chunks, iter->count * chunk_size);    \
         }                                                                      \
                                                                                \
-        free(self);                                                            \
+        prefix##_pool_enter_bucket(self, self->buckets);                       \
     }                                                                          \
                                                                                \
     COMPILER_NONNULL(1) COMPILER_COLD /* */                                    \
     static void                                                                \
     prefix##_pool_expand(struct prefix##_pool *const restrict self) {          \
         MY_ASSERT(self);                                                       \
-        XASSERT(self->buckets);                                                \
+        XASSERT(self->bump == self->bump_end);                                 \
                                                                                \
-        union prefix##_chunk *const extra_chunks =                             \
-            alloc_chunk(POOL_CHUNK_LIST_SIZE(chunk_size) * chunk_size);        \
-        for (size_t i = 0; i < POOL_CHUNK_LIST_SIZE(chunk_size) - 1; i++) {    \
-            extra_chunks[i].next = &extra_chunks[i + 1];                       \
+        if (NULL == self->buckets) {                                           \
+            self->buckets = prefix##_pool_alloc_bucket(                        \
+                self->source, POOL_INITIAL_CHUNK_LIST_SIZE(chunk_size));       \
+            prefix##_pool_enter_bucket(self, self->buckets);                   \
+            return;                                                            \
         }                                                                      \
-        extra_chunks[POOL_CHUNK_LIST_SIZE(chunk_size) - 1].next =              \
-            self->next_free_chunk;                                             \
-        self->next_free_chunk = extra_chunks;                                  \
                                                                                \
-        struct prefix##_chunks_bucket *const buckets =                         \
-            xmalloc(sizeof buckets[0]);                                        \
-        buckets->chunks = extra_chunks, buckets->next = self->buckets;         \
-        self->buckets = buckets;                                               \
+        /* Reuse the buckets left over from a previous reset, if any. */       \
+        if (NULL == self->current_bucket->next) {                              \
+            self->current_bucket->next = prefix##_pool_alloc_bucket(           \
+                self->source, POOL_CHUNK_LIST_SIZE(chunk_size));               \
+        }                                                                      \
+                                                                               \
+        prefix##_pool_enter_bucket(self, self->current_bucket->next);          \
+    }                                                                          \
+                                                                               \
+    /* Allocate past all the objects handed out so far, ignoring the free      \
+     * list. */                                                                \
+    COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1)   \
+    COMPILER_HOT COMPILER_ALWAYS_INLINE /* */                                  \
+    inline static uint64_t *                                                   \
+    prefix##_pool_alloc_fresh(struct prefix##_pool *const restrict self) {     \
+        MY_ASSERT(self);                                                       \
+                                                                               \
+        if (self->bump == self->bump_end) { prefix##_pool_expand(self); }      \
+        XASSERT(self->bump < self->bump_end);                                  \
+        union prefix##_chunk *const object = self->bump++;                     \
+        COMPILER_UNPOISON_MEMORY(object, chunk_size);                          \
+                                                                               \
+        return (uint64_t *)object + 1 /* passe the symbol */;                  \
     }                                                                          \
                                                                                \
     COMPILER_NONNULL(1, 2) COMPILER_HOT /* */                                  \
@@ -737,30 +1013,63 @@ free_chunk(void *const memory) {
     prefix##_pool_free(                                                        \
         struct prefix##_pool *const restrict self, uint64_t *restrict object); \
                                                                                \
-    COMPILER_MALLOC(prefix##_pool_free, 1) COMPILER_RETURNS_NONNULL            \
+    COMPILER_MALLOC(prefix##_pool_free, 2) COMPILER_RETURNS_NONNULL            \
     COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_HOT /* */         \
     static uint64_t *                                                          \
     prefix##_pool_alloc(struct prefix##_pool *const restrict self) {           \
         MY_ASSERT(self);                                                       \
-        XASSERT(self->buckets);                                                \
                                                                                \
-        if (NULL == self->next_free_chunk) { prefix##_pool_expand(self); }     \
-        XASSERT(self->next_free_chunk);                                        \
+        if (POOL_BUMP_FIRST && self->bump < self->bump_end) {                  \
+            return prefix##_pool_alloc_fresh(self);                            \
+        }                                                                      \
                                                                                \
-        COMPILER_UNPOISON_MEMORY(self->next_free_chunk, chunk_size);           \
-        void *const object = (void *)self->next_free_chunk;                    \
-        self->next_free_chunk = self->next_free_chunk->next;                   \
+        union prefix##_chunk *object = self->next_free_chunk;                  \
+        if (object) {                                                          \
+            COMPILER_UNPOISON_MEMORY(object, chunk_size);                      \
+            self->next_free_chunk = object->next;                              \
+            return (uint64_t *)object + 1 /* passe the symbol */;              \
+        }                                                                      \
                                                                                \
-        return (uint64_t *)object + 1 /* passe the symbol */;                  \
+        return prefix##_pool_alloc_fresh(self);                                \
+    }                                                                          \
+                                                                               \
+    /* The best tier among the chunk lists held by the pool, not counting the  \
+     * small initial one. */                                                   \
+    COMPILER_NONNULL(1) COMPILER_PURE COMPILER_WARN_UNUSED_RESULT /* */        \
+    inline static enum page_tier                                               \
+    prefix##_pool_best_tier(const struct prefix##_pool *const restrict self) { \
+        MY_ASSERT(self);                                                       \
+                                                                               \
+        enum page_tier best = PAGE_TIER_NONE;                                  \
+        for (const struct prefix##_chunks_bucket *iter = self->buckets; iter;  \
+             iter = iter->next) {                                              \
+            if (iter->count == POOL_CHUNK_LIST_SIZE(chunk_size) &&             \
+                iter->tier < best) {                                           \
+                best = iter->tier;                                             \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
+        return best;                                                           \
+    }                                                                          \
+                                                                               \
+    /* Abandon the recycled objects until the next reset. */                   \
+    COMPILER_NONNULL(1) /* */                                                  \
+    inline static void                                                         \
+    prefix##_pool_forget_free_list(                                            \
+        struct prefix##_pool *const restrict self) {                           \
+        MY_ASSERT(self);                                                       \
+                                                                               \
+        self->next_free_chunk = NULL;                                          \
     }                                                                          \
                                                                                \
+    /* Put `object` on the free list, even if it is a piece of an object      \
+     * handed out by another pool. */                                          \
     COMPILER_NONNULL(1, 2) COMPILER_HOT /* */                                  \
     static void                                                                \
-    prefix##_pool_free(                                                        \
+    prefix##_pool_adopt(                                                       \
         struct prefix##_pool *const restrict self,                             \
         uint64_t *restrict object) {                                           \
         MY_ASSERT(self);                                                       \
-        XASSERT(self->buckets);                                                \
         MY_ASSERT(object);                                                     \
                                                                                \
         object--; /* back to the symbol address */                             \
@@ -769,79 +1078,230 @@ free_chunk(void *const memory) {
         freed->next = self->next_free_chunk;                                   \
         self->next_free_chunk = freed;                                         \
         COMPILER_POISON_MEMORY(freed, chunk_size);                             \
+    }                                                                          \
+                                                                               \
+    COMPILER_NONNULL(1, 2) COMPILER_HOT /* */                                  \
+    static void                                                                \
+    prefix##_pool_free(                                                        \
+        struct prefix##_pool *const restrict self,                             \
+        uint64_t *restrict object) {                                           \
+        prefix##_pool_adopt(self, object);                                     \
     }
 
-POOL_ALLOCATOR(applicator, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(lambda, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(eraser, sizeof(uint64_t) * 2)
-POOL_ALLOCATOR(scope, sizeof(uint64_t) * 3)
-POOL_ALLOCATOR(duplicator, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(delimiter, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(cell, sizeof(uint64_t) * 3)
-POOL_ALLOCATOR(unary_call, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(binary_call, sizeof(uint64_t) * 5)
-POOL_ALLOCATOR(binary_call_aux, sizeof(uint64_t) * 5)
-POOL_ALLOCATOR(if_then_else, sizeof(uint64_t) * 5)
-POOL_ALLOCATOR(perform, sizeof(uint64_t) * 4)
-POOL_ALLOCATOR(identity_lambda, sizeof(uint64_t) * 2)
-POOL_ALLOCATOR(gc_lambda, sizeof(uint64_t) * 3)
-POOL_ALLOCATOR(lambda_c, sizeof(uint64_t) * 4)
-
-#define ALLOC_POOL_OBJECT(pool_name) pool_name##_alloc(pool_name)
-#define FREE_POOL_OBJECT(pool_name, object)                                    \
-    pool_name##_free(pool_name, (object))
+// Nodes are pooled by size rather than by symbol, so that nodes spawned by the
+// same interaction land in the same chunks.
+POOL_ALLOCATOR(words2, sizeof(uint64_t) * 2)
+POOL_ALLOCATOR(words3, sizeof(uint64_t) * 3)
+POOL_ALLOCATOR(words4, sizeof(uint64_t) * 4)
+POOL_ALLOCATOR(words5, sizeof(uint64_t) * 5)
+
+#define ALLOC_POOL_OBJECT(runtime, pool_name)                                  \
+    pool_name##_alloc(&(runtime)->pool_name)
+#define FREE_POOL_OBJECT(runtime, pool_name, object)                           \
+    pool_name##_free(&(runtime)->pool_name, (object))
+#define ALLOC_FRESH_POOL_OBJECT(runtime, pool_name)                            \
+    pool_name##_alloc_fresh(&(runtime)->pool_name)
+#define ADOPT_POOL_OBJECT(runtime, pool_name, object)                          \
+    pool_name##_adopt(&(runtime)->pool_name, (object))
 
 #define POOLS                                                                  \
-    X(applicator_pool)                                                         \
-    X(lambda_pool)                                                             \
-    X(eraser_pool)                                                             \
-    X(scope_pool)                                                              \
-    X(duplicator_pool)                                                         \
-    X(delimiter_pool)                                                          \
-    X(cell_pool)                                                               \
-    X(unary_call_pool)                                                         \
-    X(binary_call_pool)                                                        \
-    X(binary_call_aux_pool)                                                    \
-    X(if_then_else_pool)                                                       \
-    X(perform_pool)                                                            \
-    X(identity_lambda_pool)                                                    \
-    X(gc_lambda_pool)                                                          \
-    X(lambda_c_pool)
-
-#define X(pool_name) static struct pool_name *pool_name = NULL;
-POOLS
+    X(words2_pool)                                                             \
+    X(words3_pool)                                                             \
+    X(words4_pool)                                                             \
+    X(words5_pool)
+
+struct multifocus;
+
+// Everything that outlives a single reduction is owned by a runtime, so that
+// distinct runtimes can be used from distinct threads without any locking.
+struct optiscope_runtime {
+#define X(pool_name) struct pool_name pool_name;
+    POOLS
 #undef X
 
-#define X(pool_name)                                                           \
-    {                                                                          \
-        XASSERT(NULL == pool_name);                                            \
-        pool_name = pool_name##_create();                                      \
-        XASSERT(pool_name);                                                    \
-    }
+    struct memory_source memory_source;
+
+    // Multifocuses left over from the previous reductions, ready for reuse.
+    struct multifocus *spare_focuses;
+
+    // The number of reductions in progress (more than one if a native function
+    // runs the algorithm on the same runtime).
+    uint64_t nactive_runs;
+
+    // Set by `optiscope_cancel_r` (possibly from another thread) & cleared by
+    // the reduction that obeys it.
+    volatile int cancelled;
+
+    // The wall-clock time allowed for a single reduction (zero if unlimited).
+    uint64_t timeout_ms;
+};
 
 // clang-format off
-extern void optiscope_open_pools(void) { POOLS }
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_COLD
 // clang-format on
+extern struct optiscope_runtime *
+optiscope_open_runtime(void) {
+    struct optiscope_runtime *const runtime = xmalloc(sizeof *runtime);
+
+    runtime->memory_source.tier = INITIAL_PAGE_TIER;
+    runtime->memory_source.nbytes = runtime->memory_source.limit = 0;
+    runtime->memory_source.escape = NULL;
+    runtime->memory_source.deferred = runtime->memory_source.exceeded = false;
+
+#define X(pool_name)                                                           \
+    pool_name##_open(&runtime->pool_name, &runtime->memory_source);
+    POOLS
+#undef X
+
+    runtime->spare_focuses = NULL;
+    runtime->nactive_runs = 0;
+    runtime->cancelled = 0;
+    runtime->timeout_ms = 0;
+
+    return runtime;
+}
+
+// Return all the nodes to the pools at once; legal onely when no reduction is
+// in progress on the `runtime`.
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+reset_runtime(struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
+    XASSERT(0 == runtime->nactive_runs);
 
+#define X(pool_name) pool_name##_reset(&runtime->pool_name);
+    POOLS
 #undef X
+}
+
+#ifdef OPTISCOPE_ENABLE_STATS
+
+// The kind of pages actually backing the nodes of the `runtime`, as opposed to
+// the best tier that is still to be tried.
+COMPILER_NONNULL(1) COMPILER_PURE COMPILER_WARN_UNUSED_RESULT COMPILER_COLD //
+static enum page_tier
+best_page_tier(const struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
 
+    enum page_tier best = PAGE_TIER_NONE, tier;
 #define X(pool_name)                                                           \
-    {                                                                          \
-        XASSERT(pool_name);                                                    \
-        pool_name##_close(pool_name);                                          \
-        pool_name = NULL;                                                      \
-    }
+    tier = pool_name##_best_tier(&runtime->pool_name);                         \
+    if (tier < best) { best = tier; }
+    POOLS
+#undef X
 
-// clang-format off
-extern void optiscope_close_pools(void) { POOLS }
-// clang-format on
+    return best;
+}
+
+#endif // OPTISCOPE_ENABLE_STATS
+
+#ifdef OPTISCOPE_ENABLE_COMPACTION
+
+// Make subsequent allocations continue past the compacted nodes instead of
+// filling the holes scattered over the older chunks.
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+forget_free_lists(struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
+
+#define X(pool_name) pool_name##_forget_free_list(&runtime->pool_name);
+    POOLS
+#undef X
+}
+
+#endif // OPTISCOPE_ENABLE_COMPACTION
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+free_spare_focuses(struct optiscope_runtime *const restrict runtime);
 
+COMPILER_NONNULL(1) COMPILER_COLD //
+extern void
+optiscope_close_runtime(struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
+
+#define X(pool_name) pool_name##_close(&runtime->pool_name);
+    POOLS
 #undef X
 
+    free_spare_focuses(runtime);
+    free(runtime);
+}
+
 #undef POOLS
 
 #undef POOL_ALLOCATOR
+#undef POOL_BUMP_FIRST
 #undef POOL_CHUNK_LIST_SIZE
+#undef POOL_INITIAL_CHUNK_LIST_SIZE
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+extern void
+optiscope_set_memory_limit_r(
+    struct optiscope_runtime *const restrict runtime, const size_t nbytes) {
+    MY_ASSERT(runtime);
+
+    runtime->memory_source.limit = nbytes;
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+extern void
+optiscope_set_timeout_r(
+    struct optiscope_runtime *const restrict runtime,
+    const uint64_t milliseconds) {
+    MY_ASSERT(runtime);
+
+    runtime->timeout_ms = milliseconds;
+}
+
+COMPILER_NONNULL(1) //
+extern void
+optiscope_cancel_r(struct optiscope_runtime *const runtime) {
+    MY_ASSERT(runtime);
+
+    COMPILER_ATOMIC_STORE(&runtime->cancelled, 1);
+}
+
+// The runtime used by the global API.
+static struct optiscope_runtime *default_runtime = NULL;
+
+static size_t default_memory_limit = 0;
+
+static uint64_t default_timeout_ms = 0;
+
+extern void
+optiscope_open_pools(void) {
+    XASSERT(NULL == default_runtime);
+    default_runtime = optiscope_open_runtime();
+    optiscope_set_memory_limit_r(default_runtime, default_memory_limit);
+    optiscope_set_timeout_r(default_runtime, default_timeout_ms);
+}
+
+extern void
+optiscope_set_memory_limit(const size_t nbytes) {
+    default_memory_limit = nbytes;
+    if (default_runtime) {
+        optiscope_set_memory_limit_r(default_runtime, nbytes);
+    }
+}
+
+extern void
+optiscope_set_timeout(const uint64_t milliseconds) {
+    default_timeout_ms = milliseconds;
+    if (default_runtime) { optiscope_set_timeout_r(default_runtime, milliseconds); }
+}
+
+extern void
+optiscope_cancel(void) {
+    if (default_runtime) { optiscope_cancel_r(default_runtime); }
+}
+
+extern void
+optiscope_close_pools(void) {
+    XASSERT(default_runtime);
+    optiscope_close_runtime(default_runtime);
+    default_runtime = NULL;
+}
 
 // Nodes functionality
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
@@ -916,9 +1376,11 @@ is_interaction(const struct node f, const struct node g) {
         }                                                                      \
     } while (0)
 
-// clang-format off
-COMPILER_HOT static void free_node(const struct node node);
-// clang-format on
+struct context;
+
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+free_node(struct context *const restrict graph, const struct node node);
 
 #ifdef OPTISCOPE_ENABLE_TRACING
 
@@ -1032,32 +1494,79 @@ is_visited(
 #define OPTISCOPE_MULTIFOCUS_COUNT 4096
 #endif
 
+#ifndef OPTISCOPE_PREFETCH_DISTANCE
+#define OPTISCOPE_PREFETCH_DISTANCE 4
+#endif
+
+#ifndef OPTISCOPE_POLL_INTERVAL
+#define OPTISCOPE_POLL_INTERVAL 4096
+#endif
+
 struct multifocus {
     size_t count, capacity;
     struct node *array;
+    struct memory_source *source;
+    struct multifocus *next_spare;
 };
 
-COMPILER_RETURNS_NONNULL COMPILER_COLD //
+COMPILER_RETURNS_NONNULL COMPILER_NONNULL(1) COMPILER_COLD //
 static struct multifocus *
-alloc_focus(const size_t initial_capacity) {
+alloc_focus(
+    struct optiscope_runtime *const restrict runtime,
+    const size_t initial_capacity) {
+    MY_ASSERT(runtime);
     XASSERT(initial_capacity > 0);
 
-    struct multifocus *const focus = xmalloc(sizeof *focus);
+    struct multifocus *focus = runtime->spare_focuses;
+    if (focus) {
+        runtime->spare_focuses = focus->next_spare;
+        focus->count = 0;
+        return focus;
+    }
+
+    reserve_memory(
+        &runtime->memory_source, sizeof focus->array[0] * initial_capacity);
+
+    focus = xmalloc(sizeof *focus);
     focus->count = 0;
     focus->capacity = initial_capacity;
     focus->array = xmalloc(sizeof focus->array[0] * initial_capacity);
+    focus->source = &runtime->memory_source;
+    focus->next_spare = NULL;
 
     return focus;
 }
 
-COMPILER_COLD //
+COMPILER_NONNULL(1) COMPILER_COLD //
 static void
-free_focus(struct multifocus *const restrict focus) {
+free_focus(
+    struct optiscope_runtime *const restrict runtime,
+    struct multifocus *const restrict focus) {
+    MY_ASSERT(runtime);
+
     if (focus) {
         XASSERT(focus->count <= focus->capacity);
-        free(focus->array);
-        free(focus);
+        // Keep the (possibly expanded) array for the next reduction.
+        focus->next_spare = runtime->spare_focuses;
+        runtime->spare_focuses = focus;
+    }
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+free_spare_focuses(struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
+
+    struct multifocus *iter = runtime->spare_focuses;
+    while (iter) {
+        struct multifocus *const next = iter->next_spare;
+        release_memory(iter->source, sizeof iter->array[0] * iter->capacity);
+        free(iter->array);
+        free(iter);
+        iter = next;
     }
+
+    runtime->spare_focuses = NULL;
 }
 
 COMPILER_NONNULL(1) COMPILER_COLD //
@@ -1066,6 +1575,8 @@ expand_focus(struct multifocus *const restrict focus) {
     MY_ASSERT(focus);
     XASSERT(focus->count == focus->capacity);
 
+    reserve_memory(focus->source, sizeof focus->array[0] * focus->capacity);
+
     focus->array =
         realloc(focus->array, sizeof focus->array[0] * (focus->capacity *= 2));
     if (NULL == focus->array) { //
@@ -1106,15 +1617,128 @@ unfocus_or(
     return focus->count > 0 ? unfocus(focus) : fallback;
 }
 
-#define CONSUME_MULTIFOCUS(focus, f)                                           \
-    for (struct node f = {NULL};                                               \
-         (focus)->count > 0 ? (f = unfocus((focus)), true) : false;            \
-         (void)0)
+// Request the node that is `OPTISCOPE_PREFETCH_DISTANCE` positions after the
+// `i`th one, & the partner of the node half that distance away, while the `i`th
+// node is being processed; the nodes from the `end` onwards are ignored. Onely
+// legal if all the focused nodes are alive.
+COMPILER_NONNULL(1) COMPILER_HOT COMPILER_ALWAYS_INLINE //
+inline static void
+prefetch_focus(
+    const struct multifocus *const restrict focus,
+    const size_t i,
+    const size_t end) {
+    MY_ASSERT(focus);
+    XASSERT(end <= focus->count);
 
-// The main context functionality
-// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+#if OPTISCOPE_PREFETCH_DISTANCE > 0
+    const size_t far = OPTISCOPE_PREFETCH_DISTANCE,
+                 near = (OPTISCOPE_PREFETCH_DISTANCE + 1) / 2;
 
-// clang-format off
+    if (i + far < end) { COMPILER_PREFETCH(focus->array[i + far].ports); }
+    if (i + near < end) {
+        const struct node f = focus->array[i + near];
+        COMPILER_PREFETCH(DECODE_ADDRESS(f.ports[0]));
+    }
+#else
+    (void)focus, (void)i, (void)end;
+#endif
+}
+
+// Remove the first `n` nodes from the `focus`.
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+unfocus_first(struct multifocus *const restrict focus, const size_t n) {
+    MY_ASSERT(focus);
+    XASSERT(n <= focus->count);
+
+    focus->count -= n;
+    memmove(
+        focus->array, focus->array + n, sizeof focus->array[0] * focus->count);
+}
+
+#define CONSUME_MULTIFOCUS(focus, f)                                           \
+    for (struct node f = {NULL};                                               \
+         (focus)->count > 0 ? (f = unfocus((focus)), true) : false;            \
+         (void)0)
+
+// Work stacks
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+// An explicit stack of fixed-size work items, which the traversals of lambda
+// terms use instead of the C stack, so that arbitrarily deep terms can be
+// translated & read back.
+struct work_stack {
+    size_t count, capacity, item_size;
+    char *items;
+};
+
+#define WORK_STACK_CAPACITY 256
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_COLD //
+static struct work_stack
+alloc_work_stack(const size_t item_size) {
+    XASSERT(item_size > 0);
+
+    return (struct work_stack){
+        .count = 0,
+        .capacity = WORK_STACK_CAPACITY,
+        .item_size = item_size,
+        .items = xmalloc(item_size * WORK_STACK_CAPACITY),
+    };
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+free_work_stack(struct work_stack *const restrict stack) {
+    MY_ASSERT(stack);
+
+    free(stack->items);
+    stack->items = NULL;
+}
+
+// Returnes the slot of a new item on top of the `stack`.
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static void *
+push_work(struct work_stack *const restrict stack) {
+    MY_ASSERT(stack);
+    XASSERT(stack->count <= stack->capacity);
+
+    if (stack->count == stack->capacity) {
+        stack->items =
+            realloc(stack->items, stack->item_size * (stack->capacity *= 2));
+        if (NULL == stack->items) { panic("Failed to expand the work stack!"); }
+    }
+
+    return stack->items + stack->item_size * stack->count++;
+}
+
+// Returnes the top item of the `stack`, which stayes valid until the next push.
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static void *
+pop_work(struct work_stack *const restrict stack) {
+    MY_ASSERT(stack);
+    XASSERT(stack->count > 0);
+
+    return stack->items + stack->item_size * --stack->count;
+}
+
+// Returnes the top item of the `stack` without removing it.
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static void *
+peek_work(struct work_stack *const restrict stack) {
+    MY_ASSERT(stack);
+    XASSERT(stack->count > 0);
+
+    return stack->items + stack->item_size * (stack->count - 1);
+}
+
+#define PUSH_WORK(stack, type, ...)                                            \
+    (*(type *)push_work((stack)) = (type){__VA_ARGS__})
+
+// The main context functionality
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+// clang-format off
 #define CONTEXT_MULTIFOCUSES \
     X(betas) X(closed_betas) X(identity_betas) X(gc_betas) \
     X(unary_calls) X(binary_calls) X(binary_calls_aux) X(if_then_elses) \
@@ -1123,12 +1747,37 @@ unfocus_or(
 // clang-format on
 
 struct context {
+    struct optiscope_runtime *runtime;
     struct node root;
     uint64_t phase;
 
+    // The number of graph walks performed so far & the mark of the last one,
+    // which is also given to the new nodes (see `walk_graph`).
+    uint64_t epoch, mark;
+
     // Indicates whether the interface normal form has been reached.
     bool time_to_stop;
 
+    // The number of interactions left until the next checkpoint (see
+    // `refuel`), & the rest of the budget beyond it.
+    uint64_t fuel, reserve;
+
+    // The steps left until the next checkpoint in the loops that doe not
+    // performe interactions (e.g., graph walks & garbage collection).
+    uint64_t nsteps_to_poll;
+
+    // The interactions left until the active pairs are collected anew by a
+    // graph walk during x-rules normalization (see `normalize_x_rules`).
+    uint64_t nsteps_to_walk;
+
+    // Whether a rule might have created active pairs that have not been
+    // registered (see `interact`).
+    bool lost_pairs;
+
+    // When the reduction is to be abandoned (in nanoseconds, as returned by
+    // `monotonic_ns`), or zero if never.
+    uint64_t deadline;
+
 #define X(focus_name) struct multifocus *focus_name;
     CONTEXT_MULTIFOCUSES
 #undef X
@@ -1138,10 +1787,22 @@ struct context {
     CONTEXT_MULTIFOCUSES
 #undef X
     uint64_t nmergings, ngc;
+
+    // The number of live nodes & the memory they occupy (in words).
+    uint64_t nnodes, nwords, npeak_nodes, npeak_words;
 #endif
 
     struct multifocus *gc_focus, *unshare_focus;
 
+    // The weak reduction stack, also used for graph traversals.
+    struct multifocus *stack;
+
+#ifdef OPTISCOPE_ENABLE_COMPACTION
+    // The nodes already copied by `compact_graph`, which owns them onely while
+    // it runs; kept here so that they are released if the copy is abandoned.
+    struct multifocus *relocated;
+#endif
+
 #ifdef OPTISCOPE_ENABLE_GRAPHVIZ
     struct node current_pair[2];
 #endif
@@ -1153,18 +1814,28 @@ free_context(struct context *const restrict graph);
 
 // clang-format off
 COMPILER_MALLOC(free_context, 1) COMPILER_RETURNS_NONNULL
-COMPILER_WARN_UNUSED_RESULT COMPILER_COLD
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_COLD
 // clang-format on
 static struct context *
-alloc_context(void) {
+alloc_context(struct optiscope_runtime *const restrict runtime) {
+    MY_ASSERT(runtime);
+
     const struct node root = {(uint64_t *)xcalloc(2, sizeof(uint64_t)) + 1};
     root.ports[-1] = SYMBOL_ROOT;
     root.ports[0] = PORT_VALUE(UINT64_C(0), PHASE_REDUCE_WEAKLY, UINT64_C(0));
 
     struct context *const graph = xmalloc(sizeof *graph);
+    graph->runtime = runtime;
     graph->root = root;
     graph->phase = PHASE_REDUCE_WEAKLY;
+    graph->epoch = 0;
+    graph->mark = epoch_mark(graph->epoch);
     graph->time_to_stop = false;
+    graph->fuel = graph->reserve = 0;
+    graph->nsteps_to_poll = OPTISCOPE_POLL_INTERVAL;
+    graph->nsteps_to_walk = 0;
+    graph->lost_pairs = false;
+    graph->deadline = 0;
 
 #define X(focus_name) graph->focus_name = NULL;
     CONTEXT_MULTIFOCUSES
@@ -1175,10 +1846,17 @@ alloc_context(void) {
     CONTEXT_MULTIFOCUSES
 #undef X
     graph->nmergings = graph->ngc = 0;
+    graph->nnodes = graph->nwords = 0;
+    graph->npeak_nodes = graph->npeak_words = 0;
 #endif
 
-    graph->gc_focus = alloc_focus(OPTISCOPE_MULTIFOCUS_COUNT);
-    graph->unshare_focus = alloc_focus(OPTISCOPE_MULTIFOCUS_COUNT);
+    graph->gc_focus = alloc_focus(runtime, OPTISCOPE_MULTIFOCUS_COUNT);
+    graph->unshare_focus = alloc_focus(runtime, OPTISCOPE_MULTIFOCUS_COUNT);
+    graph->stack = alloc_focus(runtime, OPTISCOPE_MULTIFOCUS_COUNT);
+
+#ifdef OPTISCOPE_ENABLE_COMPACTION
+    graph->relocated = NULL;
+#endif
 
 #ifdef OPTISCOPE_ENABLE_GRAPHVIZ
     CLEAR_MEMORY(graph->current_pair);
@@ -1197,10 +1875,14 @@ free_context(struct context *const restrict graph) {
 
     free(graph->root.ports - 1 /* back to the symbol */);
 
-#define X(focus_name) free_focus(graph->focus_name);
+#define X(focus_name) free_focus(graph->runtime, graph->focus_name);
     CONTEXT_MULTIFOCUSES
     X(gc_focus)
     X(unshare_focus)
+    X(stack)
+#ifdef OPTISCOPE_ENABLE_COMPACTION
+    X(relocated)
+#endif
 #undef X
 
     free(graph);
@@ -1216,8 +1898,123 @@ is_normalized_graph(const struct context *const restrict graph) {
 #undef X
 }
 
+// Cancellation & deadlines
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_COLD //
+static uint64_t
+monotonic_ns(void) {
+#ifdef CLOCK_MONOTONIC
+    struct timespec now;
+    if (0 != clock_gettime(CLOCK_MONOTONIC, &now)) {
+        panic("Failed to read the clock!");
+    }
+
+    return (uint64_t)now.tv_sec * UINT64_C(1000000000) + (uint64_t)now.tv_nsec;
+#else
+    // Onely a second resolution, but better than nothing.
+    return (uint64_t)time(NULL) * UINT64_C(1000000000);
+#endif
+}
+
+COMPILER_NORETURN COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+escape_reduction(
+    struct optiscope_runtime *const restrict runtime,
+    const enum optiscope_status status) {
+    MY_ASSERT(runtime);
+    MY_ASSERT(runtime->memory_source.escape);
+    XASSERT(OPTISCOPE_DONE != status);
+
+    longjmp(*runtime->memory_source.escape, (int)status);
+}
+
+// Abandon the reduction if it has been cancelled or its deadline has passed.
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+poll_reduction(struct context *const restrict graph) {
+    MY_ASSERT(graph);
+
+    struct optiscope_runtime *const runtime = graph->runtime;
+
+    // The flag is cleared by the outermost reduction (see `run_guarded`).
+    if (COMPILER_ATOMIC_LOAD(&runtime->cancelled)) {
+        escape_reduction(runtime, OPTISCOPE_CANCELLED);
+    }
+
+    if (graph->deadline > 0 && monotonic_ns() >= graph->deadline) {
+        escape_reduction(runtime, OPTISCOPE_TIMED_OUT);
+    }
+}
+
+// Poll once in `OPTISCOPE_POLL_INTERVAL` steps of a loop that performes no
+// interactions.
+#define POLL_SOMETIMES(graph)                                                  \
+    (0 == --(graph)->nsteps_to_poll                                            \
+         ? ((graph)->nsteps_to_poll = OPTISCOPE_POLL_INTERVAL,                 \
+            poll_reduction((graph)))                                           \
+         : (void)0)
+
+// Returnes the status with which the translation into `graph` must be
+// abandoned, or `OPTISCOPE_DONE` to go on. Unlike `poll_reduction`, doe not
+// escape, so that the translation can release its own memory first; the memory
+// limit is deferred meanwhile (see `optiscope_open_reduction_r`).
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+inline static enum optiscope_status
+interrupt_translation(struct context *const restrict graph) {
+    MY_ASSERT(graph);
+
+    struct optiscope_runtime *const runtime = graph->runtime;
+    XASSERT(runtime->memory_source.deferred);
+
+    if (runtime->memory_source.exceeded) { return OPTISCOPE_OUT_OF_MEMORY; }
+
+    if (0 == --graph->nsteps_to_poll) {
+        graph->nsteps_to_poll = OPTISCOPE_POLL_INTERVAL;
+        if (COMPILER_ATOMIC_LOAD(&runtime->cancelled)) {
+            return OPTISCOPE_CANCELLED;
+        }
+        if (graph->deadline > 0 && monotonic_ns() >= graph->deadline) {
+            return OPTISCOPE_TIMED_OUT;
+        }
+    }
+
+    return OPTISCOPE_DONE;
+}
+
+// Called whenever the fuel runs out: poll the reduction & transfer the next
+// portion of the budget into the fuel. Returnes `false` if the budget has been
+// spent completely.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_COLD //
+static bool
+refuel(struct context *const restrict graph) {
+    MY_ASSERT(graph);
+    XASSERT(0 == graph->fuel);
+
+    poll_reduction(graph);
+
+    graph->fuel = graph->reserve < OPTISCOPE_POLL_INTERVAL
+                      ? graph->reserve
+                      : OPTISCOPE_POLL_INTERVAL;
+    graph->reserve -= graph->fuel;
+
+    return graph->fuel > 0;
+}
+
 #ifdef OPTISCOPE_ENABLE_STATS
 
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT COMPILER_RETURNS_NONNULL //
+static const char *
+print_page_tier(const enum page_tier tier) {
+    switch (tier) {
+    case PAGE_TIER_HUGETLB: return "explicit huge pages";
+    case PAGE_TIER_TRANSPARENT: return "transparent huge pages";
+    case PAGE_TIER_REGULAR: return "regular pages";
+    case PAGE_TIER_NONE: return "none";
+    default: COMPILER_UNREACHABLE();
+    }
+}
+
 COMPILER_NONNULL(1) //
 static void
 print_stats(const struct context *const restrict graph) {
@@ -1244,6 +2041,13 @@ print_stats(const struct context *const restrict graph) {
         ninteractions + graph->nmergings + graph->ngc;
 
     printf("Total graph rewrites: %" PRIu64 "\n", nrewrites);
+    printf(
+        "Peak live nodes: %" PRIu64 " (%" PRIu64 " bytes)\n",
+        graph->npeak_nodes,
+        graph->npeak_words * (uint64_t)sizeof(uint64_t));
+    printf(
+        "Memory pages: %s\n",
+        print_page_tier(best_page_tier(graph->runtime)));
 }
 
 #else
@@ -1281,7 +2085,7 @@ alloc_node_from(
     uint64_t *ports = NULL;
 
 #define SET_PORTS_0()                                                          \
-    (ports[0] = PORT_VALUE(UINT64_C(0), graph->phase, UINT64_C(0)))
+    (ports[0] = PORT_VALUE(UINT64_C(0), graph->mark, UINT64_C(0)))
 #define SET_PORTS_1()                                                          \
     (SET_PORTS_0(),                                                            \
      ports[1] = PORT_VALUE(UINT64_C(1), UINT64_C(0), UINT64_C(0)))
@@ -1294,60 +2098,62 @@ alloc_node_from(
 
     switch (symbol) {
     case SYMBOL_APPLICATOR:
-        ports = ALLOC_POOL_OBJECT(applicator_pool), SET_PORTS_2();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool), SET_PORTS_2();
         break;
     case SYMBOL_LAMBDA:
-        ports = ALLOC_POOL_OBJECT(lambda_pool), SET_PORTS_2();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool), SET_PORTS_2();
         break;
     case SYMBOL_ERASER:
-        ports = ALLOC_POOL_OBJECT(eraser_pool), SET_PORTS_0();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words2_pool), SET_PORTS_0();
         break;
+        // clang-format on
     case SYMBOL_S:
-        ports = ALLOC_POOL_OBJECT(scope_pool), SET_PORTS_1();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool);
+        if (prototype) { ports[2] = prototype->ports[2]; }
+        SET_PORTS_1();
         break;
-        // clang-format on
     case SYMBOL_CELL:
-        ports = ALLOC_POOL_OBJECT(cell_pool);
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words3_pool);
         if (prototype) { ports[1] = prototype->ports[1]; }
         SET_PORTS_0();
         break;
     case SYMBOL_UNARY_CALL:
-        ports = ALLOC_POOL_OBJECT(unary_call_pool);
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool);
         if (prototype) { ports[2] = prototype->ports[2]; }
         SET_PORTS_1();
         break;
     case SYMBOL_BINARY_CALL:
-        ports = ALLOC_POOL_OBJECT(binary_call_pool);
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words5_pool);
         if (prototype) { ports[3] = prototype->ports[3]; }
         SET_PORTS_2();
         break;
     case SYMBOL_BINARY_CALL_AUX:
-        ports = ALLOC_POOL_OBJECT(binary_call_aux_pool);
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words5_pool);
         if (prototype) {
             ports[2] = prototype->ports[2], ports[3] = prototype->ports[3];
         }
         SET_PORTS_1();
         break;
     case SYMBOL_IF_THEN_ELSE:
-        ports = ALLOC_POOL_OBJECT(if_then_else_pool), SET_PORTS_3();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words5_pool), SET_PORTS_3();
         break;
     case SYMBOL_PERFORM:
-        ports = ALLOC_POOL_OBJECT(perform_pool), SET_PORTS_2();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool), SET_PORTS_2();
         break;
     case SYMBOL_IDENTITY_LAMBDA:
-        ports = ALLOC_POOL_OBJECT(identity_lambda_pool), SET_PORTS_0();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words2_pool), SET_PORTS_0();
         break;
     case SYMBOL_GC_LAMBDA:
-        ports = ALLOC_POOL_OBJECT(gc_lambda_pool), SET_PORTS_1();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words3_pool), SET_PORTS_1();
         break;
     case SYMBOL_LAMBDA_C:
-        ports = ALLOC_POOL_OBJECT(lambda_c_pool), SET_PORTS_2();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool), SET_PORTS_2();
         break;
     duplicator:
-        ports = ALLOC_POOL_OBJECT(duplicator_pool), SET_PORTS_2();
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool), SET_PORTS_2();
         break;
     delimiter:
-        ports = ALLOC_POOL_OBJECT(delimiter_pool);
+        ports = ALLOC_POOL_OBJECT(graph->runtime, words4_pool);
         if (prototype) { ports[2] = prototype->ports[2]; }
         SET_PORTS_1();
         break;
@@ -1359,6 +2165,16 @@ alloc_node_from(
 
     ports[-1] = symbol;
 
+#ifdef OPTISCOPE_ENABLE_STATS
+    graph->nnodes++, graph->nwords += node_words(symbol);
+    if (graph->nnodes > graph->npeak_nodes) {
+        graph->npeak_nodes = graph->nnodes;
+    }
+    if (graph->nwords > graph->npeak_words) {
+        graph->npeak_words = graph->nwords;
+    }
+#endif
+
     debug("🔨 %s", print_node((struct node){ports}));
 
     return (struct node){ports};
@@ -1382,11 +2198,12 @@ alloc_gc_node(
     return eraser;
 }
 
-COMPILER_HOT //
+COMPILER_NONNULL(1) COMPILER_HOT //
 static void
-free_node(const struct node node) {
+free_node(struct context *const restrict graph, const struct node node) {
     debug("🧹 %p", (void *)node.ports);
 
+    MY_ASSERT(graph);
     XASSERT(node.ports);
 
     const uint64_t symbol = node.ports[-1];
@@ -1405,35 +2222,84 @@ free_node(const struct node node) {
     }
 #endif
 
-    switch (symbol) {
-    case SYMBOL_APPLICATOR: FREE_POOL_OBJECT(applicator_pool, p); break;
-    case SYMBOL_LAMBDA: FREE_POOL_OBJECT(lambda_pool, p); break;
-    case SYMBOL_ERASER: FREE_POOL_OBJECT(eraser_pool, p); break;
-    case SYMBOL_S: FREE_POOL_OBJECT(scope_pool, p); break;
-    case SYMBOL_CELL: FREE_POOL_OBJECT(cell_pool, p); break;
-    case SYMBOL_UNARY_CALL: FREE_POOL_OBJECT(unary_call_pool, p); break;
-    case SYMBOL_BINARY_CALL: FREE_POOL_OBJECT(binary_call_pool, p); break;
-    case SYMBOL_BINARY_CALL_AUX:
-        FREE_POOL_OBJECT(binary_call_aux_pool, p);
-        break;
-    case SYMBOL_IF_THEN_ELSE: FREE_POOL_OBJECT(if_then_else_pool, p); break;
-    case SYMBOL_PERFORM: FREE_POOL_OBJECT(perform_pool, p); break;
-    case SYMBOL_IDENTITY_LAMBDA:
-        FREE_POOL_OBJECT(identity_lambda_pool, p);
-        break;
-    case SYMBOL_GC_LAMBDA: FREE_POOL_OBJECT(gc_lambda_pool, p); break;
-    case SYMBOL_LAMBDA_C: FREE_POOL_OBJECT(lambda_c_pool, p); break;
-    default:
-        if (symbol <= MAX_DUPLICATOR_INDEX) goto duplicator;
-        else if (symbol <= MAX_DELIMITER_INDEX) goto delimiter;
-        else COMPILER_UNREACHABLE();
-    duplicator:
-        FREE_POOL_OBJECT(duplicator_pool, p);
-        break;
-    delimiter:
-        FREE_POOL_OBJECT(delimiter_pool, p);
-        break;
+#ifdef OPTISCOPE_ENABLE_STATS
+    graph->nnodes--, graph->nwords -= node_words(symbol);
+#endif
+
+    switch (node_words(symbol)) {
+    case 2: FREE_POOL_OBJECT(graph->runtime, words2_pool, p); break;
+    case 3: FREE_POOL_OBJECT(graph->runtime, words3_pool, p); break;
+    case 4: FREE_POOL_OBJECT(graph->runtime, words4_pool, p); break;
+    case 5: FREE_POOL_OBJECT(graph->runtime, words5_pool, p); break;
+    default: COMPILER_UNREACHABLE();
+    }
+}
+
+// Turn the `node` that is about to be freed into a node of the same size with
+// the given `symbol`, sparing a round-trip through the pool & reusing memory
+// that is most likely in cache. The additional data elements are left to the
+// caller.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_HOT //
+static struct node
+recycle_node(
+    struct context *const restrict graph,
+    const struct node node,
+    const uint64_t symbol) {
+    MY_ASSERT(graph);
+    XASSERT(node.ports);
+    XASSERT(SYMBOL_ROOT != symbol);
+    XASSERT(node_words(node.ports[-1]) == node_words(symbol));
+
+    uint64_t *const ports = node.ports;
+
+    ports[-1] = symbol;
+    ports[0] = PORT_VALUE(UINT64_C(0), graph->mark, UINT64_C(0));
+    FOR_ALL_PORTS (node, i, 1) {
+        ports[i] = PORT_VALUE((uint64_t)i, UINT64_C(0), UINT64_C(0));
+    }
+
+    debug("♻️ %s", print_node(node));
+
+    return node;
+}
+
+// Turn the dying `node` of four or five words into a garbage-collecting eraser
+// that occupies the first two words of its slot; the rest of the slot goes to
+// the pool of the matching size, so that no word is lost until the next reset.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 3) COMPILER_HOT //
+static struct node
+recycle_gc_node(
+    struct context *const restrict graph,
+    const struct node node,
+    uint64_t *const restrict points_to) {
+    MY_ASSERT(graph);
+    XASSERT(node.ports);
+    MY_ASSERT(points_to);
+
+    const uint64_t nwords = node_words(node.ports[-1]);
+    XASSERT(nwords >= 4);
+
+#ifdef OPTISCOPE_ENABLE_STATS
+    graph->nwords -= nwords - node_words(SYMBOL_ERASER);
+#endif
+
+    // The remainder starts at `node.ports[1]`, which becomes its symbol.
+    uint64_t *const rest = node.ports + 2;
+    if (4 == nwords) {
+        ADOPT_POOL_OBJECT(graph->runtime, words2_pool, rest);
+    } else {
+        ADOPT_POOL_OBJECT(graph->runtime, words3_pool, rest);
     }
+
+    const struct node eraser = {node.ports};
+    eraser.ports[-1] = SYMBOL_ERASER;
+    eraser.ports[0] = PORT_VALUE(UINT64_C(0), UINT64_C(0), UINT64_C(0));
+    set_phase(&eraser.ports[0], PHASE_GC);
+    connect_ports(&eraser.ports[0], points_to);
+
+    debug("♻️ %s", print_node(eraser));
+
+    return eraser;
 }
 
 // Delimiter merging
@@ -1458,22 +2324,10 @@ assert_delimiter_template(const struct delimiter template) {
 
 #endif // NDEBUG
 
-COMPILER_NONNULL(1) COMPILER_HOT //
-static void
-inst_delimiter_as_is(
-    struct context *const restrict graph, const struct delimiter template) {
-    MY_ASSERT(graph);
-    assert_delimiter_template(template);
-
-    const struct node delim = alloc_node(graph, SYMBOL_DELIMITER(template.idx));
-    delim.ports[2] = 1;
-    connect_ports(&delim.ports[0], template.points_to);
-    connect_ports(&delim.ports[1], template.goes_from);
-}
-
-COMPILER_NONNULL(1) COMPILER_HOT //
-static void
-inst_delimiter(
+// Merge the delimiter `template` into the one it points to, if possible.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_HOT //
+static bool
+try_merge_template(
     struct context *const restrict graph, const struct delimiter template) {
     MY_ASSERT(graph);
     assert_delimiter_template(template);
@@ -1481,8 +2335,7 @@ inst_delimiter(
     const struct node g = follow_port(&template.points_to[0]);
     XASSERT(g.ports);
 
-    const bool condition = PHASE_REDUCE_WEAKLY == graph->phase &&
-                           IS_DELIMITER(g.ports[-1]) &&
+    const bool condition = IS_DELIMITER(g.ports[-1]) &&
                            1 == DECODE_OFFSET_METADATA(*template.points_to) &&
                            SYMBOL_DELIMITER(template.idx) == g.ports[-1];
     if (condition) {
@@ -1491,9 +2344,41 @@ inst_delimiter(
 #ifdef OPTISCOPE_ENABLE_STATS
         graph->nmergings++;
 #endif
+    }
+
+    return condition;
+}
+
+// Instantiate the delimiter `template`, merging it if possible & otherwise
+// recycling the dying 4-word `spare` node instead of allocating a new one.
+// Returnes whether `spare` has been consumed; if not, the caller must free it.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) COMPILER_HOT //
+static bool
+inst_delimiter_into(
+    struct context *const restrict graph,
+    const struct delimiter template,
+    const struct node spare) {
+    MY_ASSERT(graph);
+    assert_delimiter_template(template);
+    XASSERT(spare.ports);
+
+    if (try_merge_template(graph, template)) { return false; }
+
+    const struct node delim =
+        recycle_node(graph, spare, SYMBOL_DELIMITER(template.idx));
+
+    delim.ports[2] = 1;
+    connect_ports(&delim.ports[0], template.points_to);
+
+    // The wire attached to port 1 of `spare` might be kept as is (e.g., the
+    // binder wire of a lambda), in which case onely our side is updated.
+    if (DECODE_ADDRESS(*template.goes_from) == &delim.ports[1]) {
+        connect_port_to(&delim.ports[1], template.goes_from);
     } else {
-        inst_delimiter_as_is(graph, template);
+        connect_ports(&delim.ports[1], template.goes_from);
     }
+
+    return true;
 }
 
 COMPILER_NONNULL(1) COMPILER_HOT //
@@ -1502,7 +2387,6 @@ try_merge_delimiter(struct context *const restrict graph, const struct node f) {
     MY_ASSERT(graph);
     XASSERT(f.ports);
     XASSERT(IS_DELIMITER(f.ports[-1]));
-    MY_ASSERT(PHASE_REDUCE_WEAKLY == graph->phase);
 
     uint64_t *const points_to = DECODE_ADDRESS(f.ports[0]);
     XASSERT(points_to);
@@ -1522,7 +2406,7 @@ try_merge_delimiter(struct context *const restrict graph, const struct node f) {
         return;
     }
 
-    free_node(f);
+    free_node(graph, f);
 #ifdef OPTISCOPE_ENABLE_STATS
     graph->nmergings++;
 #endif
@@ -1534,7 +2418,6 @@ try_merge_if_delimiter(
     struct context *const restrict graph, const struct node f) {
     MY_ASSERT(graph);
     XASSERT(f.ports);
-    MY_ASSERT(PHASE_REDUCE_WEAKLY == graph->phase);
 
     if (IS_DELIMITER(f.ports[-1])) { try_merge_delimiter(graph, f); }
 }
@@ -1557,7 +2440,7 @@ try_duplicate(struct context *const restrict graph, const struct node f) {
         const struct node gx = alloc_node_from(graph, g.ports[-1], &g);
         connect_ports(&g.ports[0], DECODE_ADDRESS(f.ports[1]));
         connect_ports(&gx.ports[0], DECODE_ADDRESS(f.ports[2]));
-        free_node(f);
+        free_node(graph, f);
 #ifdef OPTISCOPE_ENABLE_STATS
         graph->ncommutations++;
 #endif
@@ -1768,7 +2651,7 @@ graphviz_print_symbol(const struct node node) {
         SPRINTF(" %" PRIu64, node.ports[1]);
     } else if (SYMBOL_BINARY_CALL_AUX == node.ports[-1]) {
         SPRINTF(" %" PRIu64, node.ports[3]);
-    } else if (IS_DELIMITER(node.ports[-1])) {
+    } else if (IS_DELIMITER(node.ports[-1]) || SYMBOL_S == node.ports[-1]) {
         SPRINTF(" %" PRIu64, node.ports[2]);
     }
 
@@ -1985,7 +2868,7 @@ gc_step(
 
         focus_on(graph->gc_focus, f);
 
-        free_node(g);
+        free_node(graph, g);
 
 #ifdef OPTISCOPE_ENABLE_STATS
         graph->ngc++;
@@ -2005,7 +2888,7 @@ gc_step(
         focus_on(graph->gc_focus, f);
         focus_on(graph->gc_focus, fx);
 
-        free_node(g);
+        free_node(graph, g);
 
 #ifdef OPTISCOPE_ENABLE_STATS
         graph->ngc++;
@@ -2029,7 +2912,7 @@ gc_step(
         focus_on(graph->gc_focus, fx);
         focus_on(graph->gc_focus, fxx);
 
-        free_node(g);
+        free_node(graph, g);
 
 #ifdef OPTISCOPE_ENABLE_STATS
         graph->ngc++;
@@ -2038,7 +2921,7 @@ gc_step(
     }
     annihilate:
         if (PHASE_GC != DECODE_PHASE_METADATA(g.ports[0])) {
-            free_node(f), free_node(g);
+            free_node(graph, f), free_node(graph, g);
         }
 
 #ifdef OPTISCOPE_ENABLE_STATS
@@ -2058,19 +2941,19 @@ gc_step(
             if (SYMBOL_ERASER == h.ports[-1]) {
                 connect_ports(&f.ports[0], points_to);
                 focus_on(graph->gc_focus, f);
-                free_node(g), free_node(h);
+                free_node(graph, g), free_node(graph, h);
 #ifdef OPTISCOPE_ENABLE_STATS
                 graph->ngc++;
 #endif
             } else if (is_atomic_symbol(sharable.ports[-1])) {
                 connect_ports(&sharable.ports[0], shares_with);
-                free_node(g), free_node(f);
+                free_node(graph, g), free_node(graph, f);
 #ifdef OPTISCOPE_ENABLE_STATS
                 graph->ngc++;
 #endif
             } else if (0 == symbol_index(g.ports[-1])) {
                 connect_ports(points_to, shares_with);
-                free_node(g);
+                free_node(graph, g);
 #ifdef OPTISCOPE_ENABLE_STATS
                 graph->ngc++;
 #endif
@@ -2105,73 +2988,146 @@ gc_step(
     }
 }
 
-COMPILER_NONNULL(1, 2) COMPILER_HOT //
+// Pass the erasers of `graph->gc_focus` through the garbage they are attached
+// to, & free the nodes marked as dead.
+COMPILER_NONNULL(1) COMPILER_HOT //
 static void
-gc(struct context *const restrict graph, uint64_t *const restrict port) {
-    debug("%s(%p)", __func__, (void *)port);
-
+collect_garbage(struct context *const restrict graph) {
     MY_ASSERT(graph);
-    MY_ASSERT(port);
     XASSERT(graph->gc_focus);
 
-    const struct node top_eraser = alloc_gc_node(graph, port);
-
-    // On later algorithmic phases, we just connect the erasable port with a new
-    // eraser, for garbage collection does not provide considerable benefit
-    // after the weak reduction phase.
-    if (PHASE_REDUCE_WEAKLY != graph->phase) {
-        set_phase(&top_eraser.ports[0], graph->phase);
-        return;
-    }
-
-    focus_on(graph->gc_focus, top_eraser);
-
     CONSUME_MULTIFOCUS (graph->gc_focus, f) {
         XASSERT(f.ports);
+        POLL_SOMETIMES(graph);
 
         if (PHASE_GC_AUX == DECODE_PHASE_METADATA(f.ports[0])) {
-            free_node(f);
-        } else {
-            uint64_t *const points_to = DECODE_ADDRESS(f.ports[0]);
+            free_node(graph, f);
+            continue;
+        }
 
-            const struct node g = node_of_port(points_to);
-            XASSERT(g.ports);
+        uint64_t *const points_to = DECODE_ADDRESS(f.ports[0]);
 
-            if (PHASE_GC == DECODE_PHASE_METADATA(g.ports[0])) {
-                free_node(f);
-                set_phase(&g.ports[0], PHASE_GC_AUX);
-            } else {
-                gc_step(graph, f, g, points_to - g.ports);
-            }
+        const struct node g = node_of_port(points_to);
+        XASSERT(g.ports);
+
+        if (PHASE_GC == DECODE_PHASE_METADATA(g.ports[0])) {
+            free_node(graph, f);
+            set_phase(&g.ports[0], PHASE_GC_AUX);
+        } else if (
+            PHASE_REDUCE_WEAKLY != graph->phase && points_to != g.ports &&
+            IS_PRINCIPAL_PORT(*DECODE_ADDRESS(g.ports[0]))) {
+            // On later phases, `g` might be registered in a multifocus
+            // together with its partner, so the eraser stayes where it is &
+            // the interaction rules will take over.
+            set_phase(&f.ports[0], graph->mark);
+        } else {
+            gc_step(graph, f, g, points_to - g.ports);
         }
     }
 }
 
-// Eager atomic unsharing
-// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-
-// Eliminates a (higher-order) sharing structure, thus reducing the graph size.
-COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
-static bool
-try_unshare(
-    struct context *const restrict graph,
-    uint64_t *const restrict port,
-    const struct node atom) {
-    debug("%s(%p, %s)", __func__, (void *)port, print_node(atom));
-
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+gc_from(struct context *const restrict graph, const struct node top_eraser) {
     MY_ASSERT(graph);
-    MY_ASSERT(port);
-    XASSERT(atom.ports);
-    XASSERT(graph->unshare_focus);
+    XASSERT(top_eraser.ports);
 
-    if (!is_atomic_symbol(atom.ports[-1])) { return false; }
+#ifdef OPTISCOPE_DISABLE_LATE_GC
+    // Just leave the eraser connected to the erasable port.
+    if (PHASE_REDUCE_WEAKLY != graph->phase) {
+        set_phase(&top_eraser.ports[0], graph->mark);
+        return;
+    }
+#endif
 
-    connect_ports(&atom.ports[0], port);
+    focus_on(graph->gc_focus, top_eraser);
 
-    focus_on(graph->unshare_focus, atom);
+    // On later phases, `interact` is yet to inspect the former neighbours of
+    // the active pair, some of which might be garbage; it collects the garbage
+    // afterwards.
+    if (PHASE_REDUCE_WEAKLY == graph->phase) { collect_garbage(graph); }
+}
 
-    CONSUME_MULTIFOCUS (graph->unshare_focus, f) {
-        XASSERT(f.ports);
+COMPILER_NONNULL(1, 2) COMPILER_HOT //
+static void
+gc(struct context *const restrict graph, uint64_t *const restrict port) {
+    debug("%s(%p)", __func__, (void *)port);
+
+    MY_ASSERT(graph);
+    MY_ASSERT(port);
+    XASSERT(graph->gc_focus);
+
+    gc_from(graph, alloc_gc_node(graph, port));
+}
+
+// Like `gc`, but the eraser is made out of the dying `node` (see
+// `recycle_gc_node`).
+COMPILER_NONNULL(1, 3) COMPILER_HOT //
+static void
+gc_recycling(
+    struct context *const restrict graph,
+    const struct node node,
+    uint64_t *const restrict port) {
+    debug("%s(%p)", __func__, (void *)port);
+
+    MY_ASSERT(graph);
+    XASSERT(node.ports);
+    MY_ASSERT(port);
+    XASSERT(graph->gc_focus);
+
+    gc_from(graph, recycle_gc_node(graph, node, port));
+}
+
+// Eager atomic unsharing
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+register_active_pair(
+    struct context *const restrict graph,
+    const struct node f,
+    const struct node g);
+
+// On later phases, the sharing nodes consumed by unsharing are onely marked as
+// dead, for `interact` is yet to inspect the former neighbours of the active
+// pair, some of which might be among them; it frees them afterwards.
+COMPILER_NONNULL(1) //
+static void
+free_unshared_node(
+    struct context *const restrict graph, const struct node node) {
+    MY_ASSERT(graph);
+    XASSERT(node.ports);
+
+    if (PHASE_REDUCE_WEAKLY == graph->phase) {
+        free_node(graph, node);
+    } else {
+        set_phase(&node.ports[0], PHASE_GC_AUX);
+        focus_on(graph->gc_focus, node);
+    }
+}
+
+// Eliminates a (higher-order) sharing structure, thus reducing the graph size.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static bool
+try_unshare(
+    struct context *const restrict graph,
+    uint64_t *const restrict port,
+    const struct node atom) {
+    debug("%s(%p, %s)", __func__, (void *)port, print_node(atom));
+
+    MY_ASSERT(graph);
+    MY_ASSERT(port);
+    XASSERT(atom.ports);
+    XASSERT(graph->unshare_focus);
+
+    if (!is_atomic_symbol(atom.ports[-1])) { return false; }
+
+    connect_ports(&atom.ports[0], port);
+
+    focus_on(graph->unshare_focus, atom);
+
+    CONSUME_MULTIFOCUS (graph->unshare_focus, f) {
+        XASSERT(f.ports);
 
         const struct node g = follow_port(&f.ports[0]);
         XASSERT(g.ports);
@@ -2190,7 +3146,7 @@ try_unshare(
 #ifdef OPTISCOPE_ENABLE_STATS
             graph->ncommutations++;
 #endif
-            free_node(g);
+            free_unshared_node(graph, g);
         } else if (IS_DELIMITER(g.ports[-1])) {
             connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
 
@@ -2199,7 +3155,13 @@ try_unshare(
 #ifdef OPTISCOPE_ENABLE_STATS
             graph->ncommutations++;
 #endif
-            free_node(g);
+            free_unshared_node(graph, g);
+        } else if (
+            PHASE_REDUCE_WEAKLY != graph->phase && f.ports != atom.ports &&
+            !is_either_root(f, g)) {
+            // The copies have reached their destination; the original atom
+            // is inspected by `interact`, for it is a neighbour of the pair.
+            register_active_pair(graph, f, g);
         }
     }
 
@@ -2404,6 +3366,28 @@ typedef void (*Rule)(
 #define TYPE_CHECK_RULE(name)                                                  \
     COMPILER_UNUSED static const Rule name##_type_check = name
 
+// Annihilate two counted delimiters (or scopes) of the same index, each of which
+// stands for a sequence of as many nodes as its count: the smaller sequence
+// vanishes, & what is left of the greater one takes its place.
+RULE_DEFINITION(annihilate_counted_core, graph, f, g) {
+    XASSERT(f.ports[2] > 0), XASSERT(g.ports[2] > 0);
+
+    if (f.ports[2] > g.ports[2]) {
+        f.ports[2] -= g.ports[2];
+        connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
+        free_node(graph, g);
+    } else if (g.ports[2] > f.ports[2]) {
+        g.ports[2] -= f.ports[2];
+        connect_ports(DECODE_ADDRESS(f.ports[1]), &g.ports[0]);
+        free_node(graph, f);
+    } else {
+        connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[1]));
+        free_node(graph, f), free_node(graph, g);
+    }
+}
+
+TYPE_CHECK_RULE(annihilate_counted_core);
+
 RULE_DEFINITION(annihilate, graph, f, g) {
     MY_ASSERT(graph);
     XASSERT(f.ports), XASSERT(g.ports);
@@ -2414,6 +3398,11 @@ RULE_DEFINITION(annihilate, graph, f, g) {
     graph->nannihilations++;
 #endif
 
+    if (IS_DELIMITER(f.ports[-1]) || SYMBOL_S == f.ports[-1]) {
+        annihilate_counted_core(graph, f, g);
+        return;
+    }
+
     const uint64_t n = ports_count(f.ports[-1]) - 1;
     XASSERT(n <= MAX_AUXILIARY_PORTS);
 
@@ -2422,7 +3411,7 @@ RULE_DEFINITION(annihilate, graph, f, g) {
         connect_ports(DECODE_ADDRESS(f.ports[i]), DECODE_ADDRESS(g.ports[i]));
     }
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(annihilate);
@@ -2467,8 +3456,11 @@ RULE_DEFINITION(commute, graph, f, g) {
     const bool update_symbol = (IS_ANY_LAMBDA(g.ports[-1]) && i >= 0) ||
                                (IS_DELIMITER(g.ports[-1]) && i >= j);
 
-    const uint64_t fsym =
-                       update_symbol ? bump_index(f.ports[-1], 1) : f.ports[-1],
+    // A counted delimiter `g` is crossed as many times as its count.
+    const uint64_t by = IS_DELIMITER(g.ports[-1]) ? g.ports[2] : 1;
+
+    const uint64_t fsym = update_symbol ? bump_index(f.ports[-1], by)
+                                        : f.ports[-1],
                    gsym = g.ports[-1];
 
     const uint8_t n = ports_count(f.ports[-1]) - 1,
@@ -2502,7 +3494,14 @@ RULE_DEFINITION(commute, graph, f, g) {
         }
     }
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
+
+    for (uint8_t i = 0; i < m; i++) {
+        try_merge_if_delimiter(graph, f_updates[i]);
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        try_merge_if_delimiter(graph, g_updates[i]);
+    }
 }
 
 TYPE_CHECK_RULE(commute);
@@ -2517,22 +3516,31 @@ RULE_DEFINITION(beta, graph, f, g) {
     graph->nbetas++;
 #endif
 
-    inst_delimiter(
+    // The applicator & the lambda are recycled as the two new delimiters (if
+    // they are not merged into existing ones).
+    uint64_t *const rand_port = DECODE_ADDRESS(f.ports[2]);
+
+    const bool f_recycled = inst_delimiter_into(
         graph,
         (struct delimiter){
-            .idx = 0, DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[2])});
+            .idx = 0, DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[2])},
+        f);
+
+    // Must be read after the first delimiter is in place, for the binder might
+    // be connected to the lambda body.
+    uint64_t *const binder_port = DECODE_ADDRESS(g.ports[1]);
+    bool g_recycled = false;
 
-    uint64_t *const binder_port = DECODE_ADDRESS(g.ports[1]), //
-        *const rand_port = DECODE_ADDRESS(f.ports[2]);
     const struct node rand = node_of_port(rand_port);
     if (SYMBOL_LAMBDA_C == rand.ports[-1]) {
         connect_ports(binder_port, rand_port);
     } else if (!try_unshare(graph, binder_port, rand)) {
-        inst_delimiter(
-            graph, (struct delimiter){.idx = 0, rand_port, binder_port});
+        g_recycled = inst_delimiter_into(
+            graph, (struct delimiter){.idx = 0, rand_port, binder_port}, g);
     }
 
-    free_node(f), free_node(g);
+    if (!f_recycled) { free_node(graph, f); }
+    if (!g_recycled) { free_node(graph, g); }
 }
 
 TYPE_CHECK_RULE(beta);
@@ -2550,7 +3558,7 @@ RULE_DEFINITION(beta_c, graph, f, g) {
     connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[2]));
     connect_ports(DECODE_ADDRESS(g.ports[1]), DECODE_ADDRESS(f.ports[2]));
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(beta_c);
@@ -2567,7 +3575,7 @@ RULE_DEFINITION(identity_beta, graph, f, g) {
 
     connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(f.ports[2]));
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(identity_beta);
@@ -2582,16 +3590,23 @@ RULE_DEFINITION(gc_beta, graph, f, g) {
     graph->nbetas++;
 #endif
 
-    inst_delimiter(
+    uint64_t *const rand_port = DECODE_ADDRESS(f.ports[2]);
+
+    const bool f_recycled = inst_delimiter_into(
         graph,
         (struct delimiter){
-            .idx = 0, DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[1])});
+            .idx = 0, DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[1])},
+        f);
 
     // There is a chance that the argument is fully disconnected from the root;
     // if so, we must garbage-collect it.
-    gc(graph, DECODE_ADDRESS(f.ports[2]));
+    if (f_recycled) {
+        gc(graph, rand_port);
+    } else {
+        gc_recycling(graph, f, rand_port);
+    }
 
-    free_node(f), free_node(g);
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(gc_beta);
@@ -2612,7 +3627,7 @@ RULE_DEFINITION(do_unary_call, graph, f, g) {
 #pragma GCC diagnostic pop
     connect_ports(&g.ports[0], DECODE_ADDRESS(f.ports[1]));
 
-    free_node(f);
+    free_node(graph, f);
 }
 
 TYPE_CHECK_RULE(do_unary_call);
@@ -2627,13 +3642,19 @@ RULE_DEFINITION(do_binary_call, graph, f, g) {
     graph->nbinary_calls++;
 #endif
 
-    const struct node aux = alloc_node(graph, SYMBOL_BINARY_CALL_AUX);
-    connect_ports(&aux.ports[1], DECODE_ADDRESS(f.ports[1]));
-    aux.ports[2] = f.ports[3];
-    aux.ports[3] = g.ports[1];
-    connect_ports(&aux.ports[0], DECODE_ADDRESS(f.ports[2]));
+    uint64_t *const output = DECODE_ADDRESS(f.ports[1]), //
+        *const rhs = DECODE_ADDRESS(f.ports[2]);
+    const uint64_t function = f.ports[3], lhs = g.ports[1];
 
-    free_node(f), free_node(g);
+    // The binary call becomes its own auxiliary node, which is of the same size.
+    const struct node aux = recycle_node(graph, f, SYMBOL_BINARY_CALL_AUX);
+    aux.ports[2] = function;
+    aux.ports[3] = lhs;
+    // The output wire still leads to port 1, so onely our side is updated.
+    connect_port_to(&aux.ports[1], output);
+    connect_ports(&aux.ports[0], rhs);
+
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(do_binary_call);
@@ -2654,7 +3675,7 @@ RULE_DEFINITION(do_binary_call_aux, graph, f, g) {
 #pragma GCC diagnostic pop
     connect_ports(&g.ports[0], DECODE_ADDRESS(f.ports[1]));
 
-    free_node(f);
+    free_node(graph, f);
 }
 
 TYPE_CHECK_RULE(do_binary_call_aux);
@@ -2671,12 +3692,10 @@ connect_branch(
     MY_ASSERT(choice);
     MY_ASSERT(other);
 
-    const struct node eraser = alloc_node(graph, SYMBOL_ERASER);
-
     connect_ports(DECODE_ADDRESS(f.ports[1]), choice);
-    connect_ports(&eraser.ports[0], other);
 
-    gc(graph, DECODE_ADDRESS(eraser.ports[0]));
+    // The conditional itself becomes the eraser of the rejected branch.
+    gc_recycling(graph, f, other);
 }
 
 RULE_DEFINITION(do_if_then_else, graph, f, g) {
@@ -2698,7 +3717,7 @@ RULE_DEFINITION(do_if_then_else, graph, f, g) {
         connect_branch(graph, f, if_else, if_then);
     }
 
-    free_node(f), free_node(g);
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(do_if_then_else);
@@ -2719,11 +3738,55 @@ RULE_DEFINITION(do_perform, graph, f, g) {
 
     connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(f.ports[2]));
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(do_perform);
 
+// Register the active pair on the wire of `port` (if any), which the last rule
+// has connected; `neighbours` are all the ports inspected after it, so that a
+// wire between two of them is registered once.
+COMPILER_NONNULL(1, 2, 4) COMPILER_HOT //
+static void
+discover_at(
+    struct context *const restrict graph,
+    uint64_t *const *const restrict neighbours,
+    const uint8_t n,
+    uint64_t *const restrict port) {
+    MY_ASSERT(graph);
+    MY_ASSERT(neighbours);
+    MY_ASSERT(port);
+
+    // The node might have been consumed by unsharing.
+    if (!IS_PRINCIPAL_PORT(*port) ||
+        PHASE_GC_AUX == DECODE_PHASE_METADATA(*port)) {
+        return;
+    }
+
+    // Garbage-collecting erasers are handled by `collect_garbage`.
+    uint64_t *const partner = DECODE_ADDRESS(*port);
+    if (!IS_PRINCIPAL_PORT(*partner) ||
+        PHASE_GC == DECODE_PHASE_METADATA(*partner)) {
+        return;
+    }
+
+    const struct node f = {port}, g = {partner};
+    if (is_either_root(f, g)) { return; }
+
+    // A pair of erasers is garbage that nothing can reach.
+    if (SYMBOL_ERASER == f.ports[-1] && SYMBOL_ERASER == g.ports[-1]) {
+        return;
+    }
+
+    if (compare_node_ptrs(f, g) > 0) {
+        for (uint8_t i = 0; i < n; i++) {
+            if (partner == neighbours[i]) { return; }
+        }
+    }
+
+    register_active_pair(graph, f, g);
+}
+
 COMPILER_NONNULL(1, 2) COMPILER_HOT //
 static void
 interact(
@@ -2738,7 +3801,68 @@ interact(
     const struct node g = follow_port(&f.ports[0]);
     XASSERT(g.ports);
 
+    // A new active pair can onely appear on a wire that the rule has connected
+    // to a former neighbour of `f` or `g` (or that unsharing has moved an atom
+    // to, which `try_unshare` handles itself). If `f` & `g` are connected by
+    // an auxiliary wire as well, the rule connects the new nodes to each other,
+    // so the graph is to be walked once the multifocuses are exhausted.
+    uint64_t *neighbours[2 * MAX_AUXILIARY_PORTS];
+    uint8_t n = 0;
+    const struct node pair[] = {f, g};
+    for (uint8_t k = 0; k < 2; k++) {
+        FOR_ALL_PORTS (pair[k], i, 1) {
+            uint64_t *const port = DECODE_ADDRESS(pair[k].ports[i]);
+            const struct node h = node_of_port(port);
+
+            if (h.ports == f.ports || h.ports == g.ports) {
+                graph->lost_pairs = true;
+            } else {
+                neighbours[n++] = port;
+            }
+        }
+    }
+
     rule(graph, f, g);
+
+    for (uint8_t i = 0; i < n; i++) {
+        discover_at(graph, neighbours, n, neighbours[i]);
+    }
+
+    collect_garbage(graph);
+}
+
+// Fire the `rule` on each node of the `focus` in the order of registration,
+// but onely on the nodes that were there before the call: the active pairs
+// created meanwhile wait for the next round, so that an active pair that keeps
+// spawning new ones (e.g., an unfolding fixed point) cannot starve the rest.
+// Returnes `false` if either the fuel has run out or the active pairs are to
+// be collected anew.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) COMPILER_HOT
+COMPILER_ALWAYS_INLINE //
+inline static bool
+interact_all(
+    struct context *const restrict graph,
+    const Rule rule,
+    struct multifocus *const restrict focus) {
+    MY_ASSERT(graph);
+    MY_ASSERT(rule);
+    MY_ASSERT(focus);
+
+    const size_t end = focus->count;
+    size_t i = 0;
+    bool go_on = true;
+
+    while (go_on && i < end) {
+        prefetch_focus(focus, i, end);
+        // The array might be reallocated by the rule.
+        interact(graph, rule, focus->array[i++]);
+        go_on = (0 != --graph->fuel || refuel(graph)) &&
+                0 != --graph->nsteps_to_walk;
+    }
+
+    unfocus_first(focus, i);
+
+    return go_on;
 }
 
 // Specialized annihilation rules
@@ -2762,20 +3886,7 @@ interact(
 
 RULE_DEFINITION(annihilate_delim_delim, graph, f, g) {
     ANNIHILATION_PROLOGUE(graph, f, g);
-    XASSERT(f.ports[2] > 0), XASSERT(g.ports[2] > 0);
-
-    if (f.ports[2] > g.ports[2]) {
-        f.ports[2] -= g.ports[2];
-        connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
-        free_node(g);
-    } else if (g.ports[2] > f.ports[2]) {
-        g.ports[2] -= f.ports[2];
-        connect_ports(DECODE_ADDRESS(f.ports[1]), &g.ports[0]);
-        free_node(f);
-    } else {
-        connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[1]));
-        free_node(f), free_node(g);
-    }
+    annihilate_counted_core(graph, f, g);
 }
 
 TYPE_CHECK_RULE(annihilate_delim_delim);
@@ -2786,7 +3897,7 @@ RULE_DEFINITION(annihilate_dup_dup, graph, f, g) {
     connect_ports(DECODE_ADDRESS(f.ports[1]), DECODE_ADDRESS(g.ports[1]));
     connect_ports(DECODE_ADDRESS(f.ports[2]), DECODE_ADDRESS(g.ports[2]));
 
-    free_node(f), free_node(g);
+    free_node(graph, f), free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(annihilate_dup_dup);
@@ -2818,7 +3929,7 @@ RULE_DEFINITION(commute_1_2, graph, f, g) {
 
     connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
 
-    free_node(g);
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(commute_1_2);
@@ -2833,7 +3944,7 @@ RULE_DEFINITION(commute_1_3, graph, f, g) {
     connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
     connect_ports(&fx.ports[0], DECODE_ADDRESS(g.ports[2]));
 
-    free_node(g);
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(commute_1_3);
@@ -3050,7 +4161,7 @@ RULE_DEFINITION(commute_lambda_c_delim, graph, f, g) {
 
     connect_ports(&f.ports[0], DECODE_ADDRESS(g.ports[1]));
 
-    free_node(g);
+    free_node(graph, g);
 }
 
 TYPE_CHECK_RULE(commute_lambda_c_delim);
@@ -3071,174 +4182,254 @@ TYPE_CHECK_RULE(commute_lambda_c_dup);
 // Rule dispatching
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
+// Regular symbols are their own classes; all duplicators & all delimiters
+// comprise two more classes. The rule table is indexed by the classes of the
+// both symbols of an active pair.
+#define SYMBOL_CLASS_DUPLICATOR (MAX_REGULAR_SYMBOL + 1)
+#define SYMBOL_CLASS_DELIMITER  (MAX_REGULAR_SYMBOL + 2)
+#define SYMBOL_CLASSES_COUNT    (MAX_REGULAR_SYMBOL + 3)
+
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT COMPILER_HOT COMPILER_ALWAYS_INLINE //
+inline static uint8_t
+symbol_class(const uint64_t symbol) {
+    if (symbol <= MAX_REGULAR_SYMBOL) { return (uint8_t)symbol; }
+
+    return symbol <= MAX_DUPLICATOR_INDEX ? SYMBOL_CLASS_DUPLICATOR
+                                          : SYMBOL_CLASS_DELIMITER;
+}
+
+// clang-format off
+#define SIMPLE_RULES \
+    X(BETA) X(BETA_C) X(IDENTITY_BETA) X(GC_BETA) \
+    X(DO_UNARY_CALL) X(DO_BINARY_CALL) X(DO_BINARY_CALL_AUX) \
+        X(DO_IF_THEN_ELSE) X(DO_PERFORM) \
+    X(ANNIHILATE_DELIM_DELIM) X(COMMUTE) \
+    X(COMMUTE_ROOT_DELIM) X(COMMUTE_APPL_DELIM) X(COMMUTE_CELL_DELIM) \
+        X(COMMUTE_UCALL_DELIM) X(COMMUTE_BCALL_DELIM) \
+        X(COMMUTE_BCALL_AUX_DELIM) X(COMMUTE_ITE_DELIM) \
+    X(COMMUTE_APPL_DUP) X(COMMUTE_CELL_DUP) X(COMMUTE_UCALL_DUP) \
+        X(COMMUTE_BCALL_DUP) X(COMMUTE_BCALL_AUX_DUP) X(COMMUTE_ITE_DUP) \
+    X(COMMUTE_DUP_DELIM) \
+    X(COMMUTE_LAMBDA_DELIM) X(COMMUTE_IDENTITY_LAMBDA_DELIM) \
+        X(COMMUTE_GC_LAMBDA_DELIM) X(COMMUTE_LAMBDA_C_DELIM) \
+    X(COMMUTE_LAMBDA_DUP) X(COMMUTE_IDENTITY_LAMBDA_DUP) \
+        X(COMMUTE_GC_LAMBDA_DUP) X(COMMUTE_LAMBDA_C_DUP)
+// clang-format on
+
+enum rule_kind {
+#define X(rule) RULE_##rule,
+    SIMPLE_RULES
+#undef X
+    // Annihilation or commutation, depending on the indices.
+    RULE_DUP_DUP,
+    RULE_DELIM_DELIM,
+    // The interface normal form is reached.
+    RULE_STOP,
+    // The pair cannot occur.
+    RULE_NONE,
+};
+
+STATIC_ASSERT(RULE_NONE < 128, "Rule kinds must fit in 7 bits!");
+
+// A rule table entry holds the rule kind & whether the nodes must be swapped.
+#define FG(rule) ((uint8_t)(RULE_##rule << 1))
+#define GF(rule) ((uint8_t)(RULE_##rule << 1 | 1))
+
+#define RULE_OF_ROOT(g)                                                        \
+    (SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_ROOT_DELIM) :                  \
+     SYMBOL_LAMBDA == (g) ? FG(STOP) :                                         \
+     SYMBOL_IDENTITY_LAMBDA == (g) ? FG(STOP) :                                \
+     SYMBOL_GC_LAMBDA == (g) ? FG(STOP) :                                      \
+     SYMBOL_LAMBDA_C == (g) ? FG(STOP) :                                       \
+     SYMBOL_CELL == (g) ? FG(STOP) :                                           \
+     FG(NONE))
+#define RULE_OF_APPLICATOR(g)                                                  \
+    (SYMBOL_LAMBDA == (g) ? FG(BETA) :                                         \
+     SYMBOL_LAMBDA_C == (g) ? FG(BETA_C) :                                     \
+     SYMBOL_IDENTITY_LAMBDA == (g) ? FG(IDENTITY_BETA) :                       \
+     SYMBOL_GC_LAMBDA == (g) ? FG(GC_BETA) :                                   \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_APPL_DELIM) :                  \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_APPL_DUP) :                   \
+     FG(COMMUTE))
+#define RULE_OF_LAMBDA(g)                                                      \
+    (SYMBOL_APPLICATOR == (g) ? GF(BETA) :                                     \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_LAMBDA_DELIM) :                \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_LAMBDA_DUP) :                 \
+     SYMBOL_ROOT == (g) ? FG(STOP) :                                           \
+     GF(COMMUTE)) /* lambdas must alwaies be the second */
+#define RULE_OF_ERASER(g) FG(COMMUTE)
+#define RULE_OF_S(g)                                                           \
+    (SYMBOL_S == (g) ? FG(ANNIHILATE_DELIM_DELIM) :                            \
+     FG(COMMUTE))
+#define RULE_OF_CELL(g)                                                        \
+    (SYMBOL_UNARY_CALL == (g) ? GF(DO_UNARY_CALL) :                            \
+     SYMBOL_BINARY_CALL == (g) ? GF(DO_BINARY_CALL) :                          \
+     SYMBOL_BINARY_CALL_AUX == (g) ? GF(DO_BINARY_CALL_AUX) :                  \
+     SYMBOL_IF_THEN_ELSE == (g) ? GF(DO_IF_THEN_ELSE) :                        \
+     SYMBOL_PERFORM == (g) ? GF(DO_PERFORM) :                                  \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_CELL_DELIM) :                  \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_CELL_DUP) :                   \
+     SYMBOL_ROOT == (g) ? FG(STOP) :                                           \
+     FG(COMMUTE))
+#define RULE_OF_UNARY_CALL(g)                                                  \
+    (SYMBOL_CELL == (g) ? FG(DO_UNARY_CALL) :                                  \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_UCALL_DELIM) :                 \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_UCALL_DUP) :                  \
+     FG(COMMUTE))
+#define RULE_OF_BINARY_CALL(g)                                                 \
+    (SYMBOL_CELL == (g) ? FG(DO_BINARY_CALL) :                                 \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_BCALL_DELIM) :                 \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_BCALL_DUP) :                  \
+     FG(COMMUTE))
+#define RULE_OF_BINARY_CALL_AUX(g)                                             \
+    (SYMBOL_CELL == (g) ? FG(DO_BINARY_CALL_AUX) :                             \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_BCALL_AUX_DELIM) :             \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_BCALL_AUX_DUP) :              \
+     FG(COMMUTE))
+#define RULE_OF_IF_THEN_ELSE(g)                                                \
+    (SYMBOL_CELL == (g) ? FG(DO_IF_THEN_ELSE) :                                \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_ITE_DELIM) :                   \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_ITE_DUP) :                    \
+     FG(COMMUTE))
+#define RULE_OF_PERFORM(g)                                                     \
+    (SYMBOL_CELL == (g) ? FG(DO_PERFORM) :                                     \
+     FG(COMMUTE))
+#define RULE_OF_IDENTITY_LAMBDA(g)                                             \
+    (SYMBOL_APPLICATOR == (g) ? GF(IDENTITY_BETA) :                            \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_IDENTITY_LAMBDA_DELIM) :       \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_IDENTITY_LAMBDA_DUP) :        \
+     SYMBOL_ROOT == (g) ? FG(STOP) :                                           \
+     GF(COMMUTE)) /* same as for `SYMBOL_LAMBDA` */
+#define RULE_OF_GC_LAMBDA(g)                                                   \
+    (SYMBOL_APPLICATOR == (g) ? GF(GC_BETA) :                                  \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_GC_LAMBDA_DELIM) :             \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_GC_LAMBDA_DUP) :              \
+     SYMBOL_ROOT == (g) ? FG(STOP) :                                           \
+     GF(COMMUTE)) /* same as for `SYMBOL_LAMBDA` */
+#define RULE_OF_LAMBDA_C(g)                                                    \
+    (SYMBOL_APPLICATOR == (g) ? GF(BETA_C) :                                   \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_LAMBDA_C_DELIM) :              \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? FG(COMMUTE_LAMBDA_C_DUP) :               \
+     SYMBOL_ROOT == (g) ? FG(STOP) :                                           \
+     GF(COMMUTE)) /* same as for `SYMBOL_LAMBDA` */
+#define RULE_OF_DUPLICATOR(g)                                                  \
+    (SYMBOL_CLASS_DUPLICATOR == (g) ? FG(DUP_DUP) :                            \
+     SYMBOL_APPLICATOR == (g) ? GF(COMMUTE_APPL_DUP) :                         \
+     SYMBOL_LAMBDA == (g) ? GF(COMMUTE_LAMBDA_DUP) :                           \
+     SYMBOL_IDENTITY_LAMBDA == (g) ? GF(COMMUTE_IDENTITY_LAMBDA_DUP) :         \
+     SYMBOL_GC_LAMBDA == (g) ? GF(COMMUTE_GC_LAMBDA_DUP) :                     \
+     SYMBOL_LAMBDA_C == (g) ? GF(COMMUTE_LAMBDA_C_DUP) :                       \
+     SYMBOL_CELL == (g) ? GF(COMMUTE_CELL_DUP) :                               \
+     SYMBOL_UNARY_CALL == (g) ? GF(COMMUTE_UCALL_DUP) :                        \
+     SYMBOL_BINARY_CALL == (g) ? GF(COMMUTE_BCALL_DUP) :                       \
+     SYMBOL_BINARY_CALL_AUX == (g) ? GF(COMMUTE_BCALL_AUX_DUP) :               \
+     SYMBOL_IF_THEN_ELSE == (g) ? GF(COMMUTE_ITE_DUP) :                        \
+     SYMBOL_CLASS_DELIMITER == (g) ? FG(COMMUTE_DUP_DELIM) :                   \
+     FG(COMMUTE))
+// Delimiters must be the second, unlesse they commute with lambdas.
+#define RULE_OF_DELIMITER(g)                                                   \
+    (SYMBOL_CLASS_DELIMITER == (g) ? FG(DELIM_DELIM) :                         \
+     SYMBOL_ROOT == (g) ? GF(COMMUTE_ROOT_DELIM) :                             \
+     SYMBOL_APPLICATOR == (g) ? GF(COMMUTE_APPL_DELIM) :                       \
+     SYMBOL_LAMBDA == (g) ? GF(COMMUTE_LAMBDA_DELIM) :                         \
+     SYMBOL_IDENTITY_LAMBDA == (g) ? GF(COMMUTE_IDENTITY_LAMBDA_DELIM) :       \
+     SYMBOL_GC_LAMBDA == (g) ? GF(COMMUTE_GC_LAMBDA_DELIM) :                   \
+     SYMBOL_LAMBDA_C == (g) ? GF(COMMUTE_LAMBDA_C_DELIM) :                     \
+     SYMBOL_CELL == (g) ? GF(COMMUTE_CELL_DELIM) :                             \
+     SYMBOL_UNARY_CALL == (g) ? GF(COMMUTE_UCALL_DELIM) :                      \
+     SYMBOL_BINARY_CALL == (g) ? GF(COMMUTE_BCALL_DELIM) :                     \
+     SYMBOL_BINARY_CALL_AUX == (g) ? GF(COMMUTE_BCALL_AUX_DELIM) :             \
+     SYMBOL_IF_THEN_ELSE == (g) ? GF(COMMUTE_ITE_DELIM) :                      \
+     SYMBOL_CLASS_DUPLICATOR == (g) ? GF(COMMUTE_DUP_DELIM) :                  \
+     GF(COMMUTE))
+
+#define RULE_OF(f, g)                                                          \
+    (SYMBOL_ROOT == (f) ? RULE_OF_ROOT(g) :                                    \
+     SYMBOL_APPLICATOR == (f) ? RULE_OF_APPLICATOR(g) :                        \
+     SYMBOL_LAMBDA == (f) ? RULE_OF_LAMBDA(g) :                                \
+     SYMBOL_ERASER == (f) ? RULE_OF_ERASER(g) :                                \
+     SYMBOL_S == (f) ? RULE_OF_S(g) :                                          \
+     SYMBOL_CELL == (f) ? RULE_OF_CELL(g) :                                    \
+     SYMBOL_UNARY_CALL == (f) ? RULE_OF_UNARY_CALL(g) :                        \
+     SYMBOL_BINARY_CALL == (f) ? RULE_OF_BINARY_CALL(g) :                      \
+     SYMBOL_BINARY_CALL_AUX == (f) ? RULE_OF_BINARY_CALL_AUX(g) :              \
+     SYMBOL_IF_THEN_ELSE == (f) ? RULE_OF_IF_THEN_ELSE(g) :                    \
+     SYMBOL_PERFORM == (f) ? RULE_OF_PERFORM(g) :                              \
+     SYMBOL_IDENTITY_LAMBDA == (f) ? RULE_OF_IDENTITY_LAMBDA(g) :              \
+     SYMBOL_GC_LAMBDA == (f) ? RULE_OF_GC_LAMBDA(g) :                          \
+     SYMBOL_LAMBDA_C == (f) ? RULE_OF_LAMBDA_C(g) :                            \
+     SYMBOL_CLASS_DUPLICATOR == (f) ? RULE_OF_DUPLICATOR(g) :                  \
+     SYMBOL_CLASS_DELIMITER == (f) ? RULE_OF_DELIMITER(g) :                    \
+     FG(NONE))
+
+#define RULE_ROW(f)                                                            \
+    {RULE_OF(f, 0), RULE_OF(f, 1), RULE_OF(f, 2), RULE_OF(f, 3),               \
+     RULE_OF(f, 4), RULE_OF(f, 5), RULE_OF(f, 6), RULE_OF(f, 7),               \
+     RULE_OF(f, 8), RULE_OF(f, 9), RULE_OF(f, 10), RULE_OF(f, 11),             \
+     RULE_OF(f, 12), RULE_OF(f, 13), RULE_OF(f, 14), RULE_OF(f, 15),           \
+     RULE_OF(f, 16), RULE_OF(f, 17)}
+
+// Computed at compile-time, so that each interaction costs onely two class
+// computations, a table lookup, & one indirect jump.
+static const uint8_t rule_table[SYMBOL_CLASSES_COUNT][SYMBOL_CLASSES_COUNT] = {
+    RULE_ROW(0),  RULE_ROW(1),  RULE_ROW(2),  RULE_ROW(3),  RULE_ROW(4),
+    RULE_ROW(5),  RULE_ROW(6),  RULE_ROW(7),  RULE_ROW(8),  RULE_ROW(9),
+    RULE_ROW(10), RULE_ROW(11), RULE_ROW(12), RULE_ROW(13), RULE_ROW(14),
+    RULE_ROW(15), RULE_ROW(16), RULE_ROW(17),
+};
+
+STATIC_ASSERT(SYMBOL_CLASSES_COUNT == 18, "Update the rule table!");
+
+#undef RULE_ROW
+#undef RULE_OF
+#undef RULE_OF_ROOT
+#undef RULE_OF_APPLICATOR
+#undef RULE_OF_LAMBDA
+#undef RULE_OF_ERASER
+#undef RULE_OF_S
+#undef RULE_OF_CELL
+#undef RULE_OF_UNARY_CALL
+#undef RULE_OF_BINARY_CALL
+#undef RULE_OF_BINARY_CALL_AUX
+#undef RULE_OF_IF_THEN_ELSE
+#undef RULE_OF_PERFORM
+#undef RULE_OF_IDENTITY_LAMBDA
+#undef RULE_OF_GC_LAMBDA
+#undef RULE_OF_LAMBDA_C
+#undef RULE_OF_DUPLICATOR
+#undef RULE_OF_DELIMITER
+#undef GF
+#undef FG
+
+// Expects `X` to expand each simple rule into two `case` labels, one for each
+// orientation of the pair (see `SIMPLE_RULE_CASES`). Switching on the whole
+// entry lets every call pass `f` & `g` in a statically known order, instead of
+// selecting the nodes at run-time, which used to cost more than the chains of
+// comparisons saved.
 #define DISPATCH_ACTIVE_PAIR(graph, f, g)                                      \
     do {                                                                       \
         const uint64_t fsym = f.ports[-1], gsym = g.ports[-1];                 \
                                                                                \
-        switch (fsym) {                                                        \
-        duplicator:                                                            \
+        switch (rule_table[symbol_class(fsym)][symbol_class(gsym)]) {          \
+            SIMPLE_RULES                                                       \
+        case RULE_DUP_DUP << 1:                                                \
             if (fsym == gsym) ANNIHILATE_DUP_DUP(graph, f, g);                 \
-            else if (SYMBOL_APPLICATOR == gsym) COMMUTE_APPL_DUP(graph, g, f); \
-            else if (SYMBOL_LAMBDA == gsym) COMMUTE_LAMBDA_DUP(graph, g, f);   \
-            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
-                COMMUTE_IDENTITY_LAMBDA_DUP(graph, g, f);                      \
-            else if (SYMBOL_GC_LAMBDA == gsym)                                 \
-                COMMUTE_GC_LAMBDA_DUP(graph, g, f);                            \
-            else if (SYMBOL_LAMBDA_C == gsym)                                  \
-                COMMUTE_LAMBDA_C_DUP(graph, g, f);                             \
-            else if (SYMBOL_CELL == gsym) COMMUTE_CELL_DUP(graph, g, f);       \
-            else if (SYMBOL_UNARY_CALL == gsym)                                \
-                COMMUTE_UCALL_DUP(graph, g, f);                                \
-            else if (SYMBOL_BINARY_CALL == gsym)                               \
-                COMMUTE_BCALL_DUP(graph, g, f);                                \
-            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
-                COMMUTE_BCALL_AUX_DUP(graph, g, f);                            \
-            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
-                COMMUTE_ITE_DUP(graph, g, f);                                  \
-            else if (IS_DELIMITER(gsym)) COMMUTE_DUP_DELIM(graph, f, g);       \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_DUP_DUP(graph, f, g);        \
-            else COMMUTE(graph, f, g);                                         \
+            else COMMUTE_DUP_DUP(graph, f, g);                                 \
             break;                                                             \
-        delimiter:                                                             \
+        case RULE_DELIM_DELIM << 1:                                            \
             if (fsym == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);             \
-            else if (SYMBOL_ROOT == gsym) COMMUTE_ROOT_DELIM(graph, g, f);     \
-            else if (SYMBOL_APPLICATOR == gsym)                                \
-                COMMUTE_APPL_DELIM(graph, g, f);                               \
-            else if (SYMBOL_LAMBDA == gsym) COMMUTE_LAMBDA_DELIM(graph, g, f); \
-            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
-                COMMUTE_IDENTITY_LAMBDA_DELIM(graph, g, f);                    \
-            else if (SYMBOL_GC_LAMBDA == gsym)                                 \
-                COMMUTE_GC_LAMBDA_DELIM(graph, g, f);                          \
-            else if (SYMBOL_LAMBDA_C == gsym)                                  \
-                COMMUTE_LAMBDA_C_DELIM(graph, g, f);                           \
-            else if (SYMBOL_CELL == gsym) COMMUTE_CELL_DELIM(graph, g, f);     \
-            else if (SYMBOL_UNARY_CALL == gsym)                                \
-                COMMUTE_UCALL_DELIM(graph, g, f);                              \
-            else if (SYMBOL_BINARY_CALL == gsym)                               \
-                COMMUTE_BCALL_DELIM(graph, g, f);                              \
-            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
-                COMMUTE_BCALL_AUX_DELIM(graph, g, f);                          \
-            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
-                COMMUTE_ITE_DELIM(graph, g, f);                                \
-            else if (IS_DELIMITER(gsym)) COMMUTE_DELIM_DELIM(graph, f, g);     \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_DUP_DELIM(graph, g, f);      \
-            else                                                               \
-                COMMUTE(graph, g, f); /* delimiters must be the second,        \
-                                         unlesse they commute with lambdas */  \
-            break;                                                             \
-        case SYMBOL_ROOT:                                                      \
-            if (IS_DELIMITER(gsym)) COMMUTE_ROOT_DELIM(graph, f, g);           \
-            else if (IS_ANY_LAMBDA(gsym) || SYMBOL_CELL == gsym)               \
-                graph->time_to_stop = true;                                    \
-            else COMPILER_UNREACHABLE();                                       \
-            break;                                                             \
-        case SYMBOL_APPLICATOR:                                                \
-            if (SYMBOL_LAMBDA == gsym) BETA(graph, f, g);                      \
-            else if (SYMBOL_LAMBDA_C == gsym) BETA_C(graph, f, g);             \
-            else if (SYMBOL_IDENTITY_LAMBDA == gsym)                           \
-                IDENTITY_BETA(graph, f, g);                                    \
-            else if (SYMBOL_GC_LAMBDA == gsym) GC_BETA(graph, f, g);           \
-            else if (IS_DELIMITER(gsym)) COMMUTE_APPL_DELIM(graph, f, g);      \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_APPL_DUP(graph, f, g);       \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_LAMBDA:                                                    \
-            if (SYMBOL_APPLICATOR == gsym) BETA(graph, g, f);                  \
-            else if (IS_DELIMITER(gsym)) COMMUTE_LAMBDA_DELIM(graph, f, g);    \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_LAMBDA_DUP(graph, f, g);     \
-            else if (SYMBOL_ROOT == gsym) graph->time_to_stop = true;          \
-            else                                                               \
-                COMMUTE(graph, g, f); /* lambdas must alwaies be the second */ \
-            break;                                                             \
-        case SYMBOL_IDENTITY_LAMBDA:                                           \
-            if (SYMBOL_APPLICATOR == gsym) IDENTITY_BETA(graph, g, f);         \
-            else if (IS_DELIMITER(gsym))                                       \
-                COMMUTE_IDENTITY_LAMBDA_DELIM(graph, f, g);                    \
-            else if (IS_DUPLICATOR(gsym))                                      \
-                COMMUTE_IDENTITY_LAMBDA_DUP(graph, f, g);                      \
-            else if (SYMBOL_ROOT == gsym) graph->time_to_stop = true;          \
-            else COMMUTE(graph, g, f); /* same as for `SYMBOL_LAMBDA` */       \
-            break;                                                             \
-        case SYMBOL_GC_LAMBDA:                                                 \
-            if (SYMBOL_APPLICATOR == gsym) GC_BETA(graph, g, f);               \
-            else if (IS_DELIMITER(gsym)) COMMUTE_GC_LAMBDA_DELIM(graph, f, g); \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_GC_LAMBDA_DUP(graph, f, g);  \
-            else if (SYMBOL_ROOT == gsym) graph->time_to_stop = true;          \
-            else COMMUTE(graph, g, f); /* same as for `SYMBOL_LAMBDA` */       \
+            else COMMUTE_DELIM_DELIM(graph, f, g);                             \
             break;                                                             \
-        case SYMBOL_LAMBDA_C:                                                  \
-            if (SYMBOL_APPLICATOR == gsym) BETA_C(graph, g, f);                \
-            else if (IS_DELIMITER(gsym)) COMMUTE_LAMBDA_C_DELIM(graph, f, g);  \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_LAMBDA_C_DUP(graph, f, g);   \
-            else if (SYMBOL_ROOT == gsym) graph->time_to_stop = true;          \
-            else COMMUTE(graph, g, f); /* same as for `SYMBOL_LAMBDA` */       \
-            break;                                                             \
-        case SYMBOL_ERASER: COMMUTE(graph, f, g); break;                       \
-        case SYMBOL_S:                                                         \
-            if (SYMBOL_S == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);         \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_CELL:                                                      \
-            if (SYMBOL_UNARY_CALL == gsym) DO_UNARY_CALL(graph, g, f);         \
-            else if (SYMBOL_BINARY_CALL == gsym) DO_BINARY_CALL(graph, g, f);  \
-            else if (SYMBOL_BINARY_CALL_AUX == gsym)                           \
-                DO_BINARY_CALL_AUX(graph, g, f);                               \
-            else if (SYMBOL_IF_THEN_ELSE == gsym)                              \
-                DO_IF_THEN_ELSE(graph, g, f);                                  \
-            else if (SYMBOL_PERFORM == gsym) DO_PERFORM(graph, g, f);          \
-            else if (IS_DELIMITER(gsym)) COMMUTE_CELL_DELIM(graph, f, g);      \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_CELL_DUP(graph, f, g);       \
-            else if (SYMBOL_ROOT == gsym) graph->time_to_stop = true;          \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_UNARY_CALL:                                                \
-            if (SYMBOL_CELL == gsym) DO_UNARY_CALL(graph, f, g);               \
-            else if (IS_DELIMITER(gsym)) COMMUTE_UCALL_DELIM(graph, f, g);     \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_UCALL_DUP(graph, f, g);      \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_BINARY_CALL:                                               \
-            if (SYMBOL_CELL == gsym) DO_BINARY_CALL(graph, f, g);              \
-            else if (IS_DELIMITER(gsym)) COMMUTE_BCALL_DELIM(graph, f, g);     \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_BCALL_DUP(graph, f, g);      \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_BINARY_CALL_AUX:                                           \
-            if (SYMBOL_CELL == gsym) DO_BINARY_CALL_AUX(graph, f, g);          \
-            else if (IS_DELIMITER(gsym)) COMMUTE_BCALL_AUX_DELIM(graph, f, g); \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_BCALL_AUX_DUP(graph, f, g);  \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_IF_THEN_ELSE:                                              \
-            if (SYMBOL_CELL == gsym) DO_IF_THEN_ELSE(graph, f, g);             \
-            else if (IS_DELIMITER(gsym)) COMMUTE_ITE_DELIM(graph, f, g);       \
-            else if (IS_DUPLICATOR(gsym)) COMMUTE_ITE_DUP(graph, f, g);        \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        case SYMBOL_PERFORM:                                                   \
-            if (SYMBOL_CELL == gsym) DO_PERFORM(graph, f, g);                  \
-            else COMMUTE(graph, f, g);                                         \
-            break;                                                             \
-        default:                                                               \
-            if (fsym <= MAX_DUPLICATOR_INDEX) goto duplicator;                 \
-            else if (fsym <= MAX_DELIMITER_INDEX) goto delimiter;              \
-            else COMPILER_UNREACHABLE();                                       \
+        case RULE_STOP << 1: graph->time_to_stop = true; break;                \
+        default: COMPILER_UNREACHABLE();                                       \
         }                                                                      \
     } while (false)
 
-COMPILER_NONNULL(1) COMPILER_HOT //
-static void
-fire_rule(
-    struct context *const restrict graph,
-    const struct node f,
-    const struct node g) {
-    MY_ASSERT(graph);
-    XASSERT(f.ports), XASSERT(g.ports);
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-result"
-    MY_ASSERT(is_interaction(f, g));
-#pragma GCC diagnostic pop
+#define SIMPLE_RULE_CASES(rule)                                                \
+    case RULE_##rule << 1: rule(graph, f, g); break;                           \
+    case RULE_##rule << 1 | 1: rule(graph, g, f); break;
 
+// The rules fired during reduction.
 #define BETA                          beta
 #define BETA_C                        beta_c
 #define IDENTITY_BETA                 identity_beta
@@ -3276,7 +4467,128 @@ fire_rule(
 #define COMMUTE_LAMBDA_C_DELIM        commute_lambda_c_delim
 #define COMMUTE_LAMBDA_C_DUP          commute_lambda_c_dup
 
+#ifndef COMPILER_LABELS_AS_VALUES
+
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+fire_rule(
+    struct context *const restrict graph,
+    const struct node f,
+    const struct node g) {
+    MY_ASSERT(graph);
+    XASSERT(f.ports), XASSERT(g.ports);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-result"
+    MY_ASSERT(is_interaction(f, g));
+#pragma GCC diagnostic pop
+
+#define X SIMPLE_RULE_CASES
     DISPATCH_ACTIVE_PAIR(graph, f, g);
+#undef X
+}
+
+#else
+
+// Weak reduction as direct-threaded code: instead of returning to a common
+// loop, each rule handler looks for the next active pair itself & jumps
+// straight to its handler, so that every handler has its own indirect jump
+// (& its own branch history). The portable loop is in `weak_reduction`.
+COMPILER_NONNULL(1) COMPILER_HOT //
+static void
+weak_reduction_threaded(struct context *const restrict graph) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(graph);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+    // Indexed by whole rule table entries, like `DISPATCH_ACTIVE_PAIR`.
+    static const void *const handlers[] = {
+#define X(rule) &&rule_##rule, &&rule_##rule##_swapped,
+        SIMPLE_RULES
+#undef X
+        &&rule_DUP_DUP,
+        &&rule_NONE,
+        &&rule_DELIM_DELIM,
+        &&rule_NONE,
+        &&rule_STOP,
+        &&rule_NONE,
+        &&rule_NONE,
+        &&rule_NONE,
+    };
+
+    STATIC_ASSERT(
+        ARRAY_LENGTH(handlers) == 2 * (RULE_NONE + 1), "Update the handlers!");
+
+    struct multifocus *const stack = graph->stack;
+
+    struct node f, g;
+    uint64_t fsym, gsym;
+
+#if OPTISCOPE_PREFETCH_DISTANCE > 0
+#define PREFETCH_STACK_TOP()                                                   \
+    (stack->count > 0                                                          \
+         ? COMPILER_PREFETCH(stack->array[stack->count - 1].ports)             \
+         : (void)0)
+#else
+#define PREFETCH_STACK_TOP() ((void)0)
+#endif
+
+#define DESCEND_AND_DISPATCH()                                                 \
+    do {                                                                       \
+        while (g = follow_port(&f.ports[0]), !is_interacting_with(f, g)) {     \
+            focus_on(stack, f);                                                \
+            f = g;                                                             \
+        }                                                                      \
+        PREFETCH_STACK_TOP();                                                  \
+        fsym = f.ports[-1], gsym = g.ports[-1];                                \
+        goto *handlers[rule_table[symbol_class(fsym)][symbol_class(gsym)]];    \
+    } while (false)
+
+#define NEXT()                                                                 \
+    do {                                                                       \
+        if (0 == --graph->fuel && !refuel(graph)) { return; }                  \
+        f = unfocus_or(stack, graph->root);                                    \
+        DESCEND_AND_DISPATCH();                                                \
+    } while (false)
+
+    f = unfocus_or(stack, graph->root);
+    DESCEND_AND_DISPATCH();
+
+#define X(rule)                                                                \
+    rule_##rule : rule(graph, f, g);                                           \
+    NEXT();                                                                    \
+    rule_##rule##_swapped : rule(graph, g, f);                                 \
+    NEXT();
+    SIMPLE_RULES
+#undef X
+
+rule_DUP_DUP:
+    if (fsym == gsym) ANNIHILATE_DUP_DUP(graph, f, g);
+    else COMMUTE_DUP_DUP(graph, f, g);
+    NEXT();
+
+rule_DELIM_DELIM:
+    if (fsym == gsym) ANNIHILATE_DELIM_DELIM(graph, f, g);
+    else COMMUTE_DELIM_DELIM(graph, f, g);
+    NEXT();
+
+rule_NONE:
+    COMPILER_UNREACHABLE();
+
+rule_STOP:
+    graph->time_to_stop = true;
+    stack->count = 0;
+
+#undef NEXT
+#undef DESCEND_AND_DISPATCH
+#undef PREFETCH_STACK_TOP
+
+#pragma GCC diagnostic pop
+}
+
+#endif // COMPILER_LABELS_AS_VALUES
 
 #undef COMMUTE_LAMBDA_C_DUP
 #undef COMMUTE_LAMBDA_C_DELIM
@@ -3314,7 +4626,6 @@ fire_rule(
 #undef IDENTITY_BETA
 #undef BETA_C
 #undef BETA
-}
 
 COMPILER_NONNULL(1) COMPILER_HOT //
 static void
@@ -3370,7 +4681,9 @@ register_active_pair(
 #define COMMUTE_GC_LAMBDA_DUP(graph, f, g)       COMMUTE(graph, g, f)
 #define COMMUTE_LAMBDA_C_DUP(graph, f, g)        COMMUTE(graph, g, f)
 
+#define X SIMPLE_RULE_CASES
     DISPATCH_ACTIVE_PAIR(graph, f, g);
+#undef X
 
 #undef COMMUTE_LAMBDA_C_DUP
 #undef COMMUTE_GC_LAMBDA_DUP
@@ -3412,37 +4725,13 @@ register_active_pair(
 #undef BETA
 }
 
+#undef SIMPLE_RULE_CASES
 #undef DISPATCH_ACTIVE_PAIR
+#undef SIMPLE_RULES
 
 // Higher-order control structures
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
-COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
-static uint64_t *
-build_delimiter_sequence(
-    struct context *const restrict graph,
-    uint64_t *const restrict binder_port,
-    const uint64_t idx,
-    const uint64_t n) {
-    MY_ASSERT(graph);
-    MY_ASSERT(binder_port);
-    XASSERT(n > 0);
-
-    struct node current = alloc_node(graph, SYMBOL_DELIMITER(idx));
-    current.ports[2] = 1;
-    uint64_t *const result = &current.ports[1];
-    for (uint64_t i = 1; i < n; i++) {
-        const struct node delim = alloc_node(graph, SYMBOL_DELIMITER(idx));
-        delim.ports[2] = 1;
-        connect_ports(&current.ports[0], &delim.ports[1]);
-        current = delim;
-    }
-
-    connect_ports(&current.ports[0], binder_port);
-
-    return result;
-}
-
 COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
 static uint64_t **
 build_duplicator_tree(
@@ -3476,28 +4765,39 @@ build_duplicator_tree(
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
 // This procedure is onely used _after_ weak reduction, in order to transforme
-// nodes & collect active pairs.
+// nodes & collect active pairs. Returnes the number of nodes visited.
+//
+// Each walk starts a new epoch & marks the nodes it visits with its mark, which
+// the nodes allocated afterwards inherit. Since the rules never connect a node
+// to the root that was disconnected from it, every node reachable from the
+// root carries the mark of the last walk, & so the marks need not be reset.
 COMPILER_NONNULL(1) //
-static void
+static uint64_t
 walk_graph(
     struct context *const graph,
     void (*const cb)(struct context *const, const struct node)) {
     MY_ASSERT(graph);
     XASSERT(graph->root.ports);
 
-    struct multifocus *focus = alloc_focus(OPTISCOPE_MULTIFOCUS_COUNT);
+    struct multifocus *const focus = graph->stack;
+    XASSERT(0 == focus->count);
 
+    graph->mark = epoch_mark(++graph->epoch);
     focus_on(focus, graph->root);
-    set_phase(&graph->root.ports[0], graph->phase);
+    set_phase(&graph->root.ports[0], graph->mark);
+
+    uint64_t nvisited = 0;
 
     CONSUME_MULTIFOCUS (focus, f) {
         XASSERT(f.ports);
+        POLL_SOMETIMES(graph);
+        nvisited++;
 
         FOR_ALL_PORTS (f, i, 0) {
             const struct node g = follow_port(&f.ports[i]);
 
-            if (DECODE_PHASE_METADATA(g.ports[0]) != graph->phase) {
-                set_phase(&g.ports[0], graph->phase);
+            if (DECODE_PHASE_METADATA(g.ports[0]) != graph->mark) {
+                set_phase(&g.ports[0], graph->mark);
                 focus_on(focus, g);
             }
         }
@@ -3505,19 +4805,38 @@ walk_graph(
         if (cb) { cb(graph, f); }
     }
 
-    free_focus(focus);
+    return nvisited;
 }
 
 // The graph traversal callbacks
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
+// The read-back walks start on a normalized graph, so all the active pairs of
+// their stages are the ones they create; they register them by this function,
+// which saves another walk to discover them.
 COMPILER_NONNULL(1) //
 static void
-unwind_cb(struct context *const graph, const struct node node) {
+register_if_active(struct context *const graph, const struct node f) {
     MY_ASSERT(graph);
-    XASSERT(node.ports);
-
-    if (SYMBOL_APPLICATOR != node.ports[-1]) { return; }
+    XASSERT(f.ports);
+
+    const struct node g = follow_port(&f.ports[0]);
+    XASSERT(g.ports);
+
+    const bool condition = //
+        !is_either_root(f, g) && is_interacting_with(f, g) &&
+        !(SYMBOL_ERASER == f.ports[-1] && SYMBOL_ERASER == g.ports[-1]);
+
+    if (condition) { register_active_pair(graph, f, g); }
+}
+
+COMPILER_NONNULL(1) //
+static void
+unwind_cb(struct context *const graph, const struct node node) {
+    MY_ASSERT(graph);
+    XASSERT(node.ports);
+
+    if (SYMBOL_APPLICATOR != node.ports[-1]) { return; }
 
     debug("%s(%s)", __func__, print_node(node));
     wait_for_user(graph);
@@ -3526,6 +4845,12 @@ unwind_cb(struct context *const graph, const struct node node) {
     CONNECT_NODE(node,
         DECODE_ADDRESS(node.ports[1]), DECODE_ADDRESS(node.ports[2]), DECODE_ADDRESS(node.ports[0]));
     // clang-format on
+
+    // Unwound applicators face each other onely by auxiliary ports, even if
+    // the other one is not unwound yet.
+    if (SYMBOL_APPLICATOR != follow_port(&node.ports[0]).ports[-1]) {
+        register_if_active(graph, node);
+    }
 }
 
 COMPILER_NONNULL(1) //
@@ -3540,12 +4865,18 @@ scope_remove_cb(struct context *const graph, const struct node node) {
     wait_for_user(graph);
 
     const struct node scope = alloc_node(graph, SYMBOL_S);
+    scope.ports[2] = node.ports[2];
     // clang-format off
     CONNECT_NODE(scope,
         DECODE_ADDRESS(node.ports[1]), DECODE_ADDRESS(node.ports[0]));
     // clang-format on
 
-    free_node(node);
+    free_node(graph, node);
+
+    // A pair of scopes is registered when the latter of them is created.
+    if (!IS_DELIMITER(follow_port(&scope.ports[0]).ports[-1])) {
+        register_if_active(graph, scope);
+    }
 }
 
 COMPILER_NONNULL(1) //
@@ -3566,25 +4897,8 @@ loop_cut_cb(struct context *const graph, const struct node node) {
 
     connect_ports(&node.ports[1], &side_eraser.ports[0]);
     connect_ports(&bottom_eraser.ports[0], binder_port);
-}
-
-COMPILER_NONNULL(1) //
-static void
-normalize_delimiters_cb(struct context *const graph, const struct node node) {
-    MY_ASSERT(graph);
-    XASSERT(node.ports);
-
-    if (!IS_DELIMITER(node.ports[-1])) { return; }
-
-    uint64_t *const output_port = build_delimiter_sequence(
-        graph,
-        DECODE_ADDRESS(node.ports[0]),
-        (uint64_t)symbol_index(node.ports[-1]),
-        node.ports[2]);
-
-    connect_ports(output_port, DECODE_ADDRESS(node.ports[1]));
 
-    free_node(node);
+    register_if_active(graph, bottom_eraser);
 }
 
 COMPILER_NONNULL(1) //
@@ -3609,6 +4923,14 @@ multifocus_cb(struct context *const graph, const struct node f) {
 // Conversion to a lambda term string
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
+// A node to be printed under `i` scopes, or a piece of `text` to be printed
+// after the nodes pushed above it.
+struct read_back_item {
+    const char *text;
+    struct node node;
+    uint64_t i;
+};
+
 COMPILER_NONNULL(1) //
 static void
 to_lambda_string(
@@ -3616,50 +4938,160 @@ to_lambda_string(
     MY_ASSERT(stream);
     XASSERT(node.ports);
 
-    switch (node.ports[-1]) {
-    case SYMBOL_APPLICATOR:
-        fprintf(stream, "(");
-        to_lambda_string(stream, i, follow_port(&node.ports[2]));
-        fprintf(stream, " ");
-        to_lambda_string(stream, i, follow_port(&node.ports[1]));
-        fprintf(stream, ")");
-        return;
-    case SYMBOL_LAMBDA:
-    case SYMBOL_GC_LAMBDA:
-    case SYMBOL_LAMBDA_C: {
-        const uint8_t body_port_idx =
-            IS_RELEVANT_LAMBDA(node.ports[-1]) ? 2 : 1;
-        fprintf(stream, "(λ ");
-        to_lambda_string(stream, i, follow_port(&node.ports[body_port_idx]));
-        fprintf(stream, ")");
-        return;
-    }
-    case SYMBOL_IDENTITY_LAMBDA: fprintf(stream, "(λ 0)"); return;
-    case SYMBOL_ERASER: fprintf(stream, "%" PRIu64, i); return;
-    case SYMBOL_S:
-        to_lambda_string(stream, i + 1, follow_port(&node.ports[1]));
-        return;
-    case SYMBOL_CELL:
-        fprintf(stream, "cell[%" PRIu64 "]", node.ports[1]);
-        return;
-    default: break;
+    struct work_stack stack = alloc_work_stack(sizeof(struct read_back_item));
+    PUSH_WORK(&stack, struct read_back_item, NULL, node, i);
+
+#define PUSH_TEXT(text)                                                        \
+    PUSH_WORK(&stack, struct read_back_item, (text), {NULL}, 0)
+#define PUSH_NODE(node, i)                                                     \
+    PUSH_WORK(&stack, struct read_back_item, NULL, (node), (i))
+
+    while (stack.count > 0) {
+        const struct read_back_item item =
+            *(struct read_back_item *)pop_work(&stack);
+        if (item.text) {
+            fputs(item.text, stream);
+            continue;
+        }
+
+        const struct node node = item.node;
+        XASSERT(node.ports);
+
+        switch (node.ports[-1]) {
+        case SYMBOL_APPLICATOR:
+            fprintf(stream, "(");
+            PUSH_TEXT(")");
+            PUSH_NODE(follow_port(&node.ports[1]), item.i);
+            PUSH_TEXT(" ");
+            PUSH_NODE(follow_port(&node.ports[2]), item.i);
+            continue;
+        case SYMBOL_LAMBDA:
+        case SYMBOL_GC_LAMBDA:
+        case SYMBOL_LAMBDA_C: {
+            const uint8_t body_port_idx =
+                IS_RELEVANT_LAMBDA(node.ports[-1]) ? 2 : 1;
+            fprintf(stream, "(λ ");
+            PUSH_TEXT(")");
+            PUSH_NODE(follow_port(&node.ports[body_port_idx]), item.i);
+            continue;
+        }
+        case SYMBOL_IDENTITY_LAMBDA: fprintf(stream, "(λ 0)"); continue;
+        case SYMBOL_ERASER: fprintf(stream, "%" PRIu64, item.i); continue;
+        case SYMBOL_S:
+            PUSH_NODE(follow_port(&node.ports[1]), item.i + node.ports[2]);
+            continue;
+        case SYMBOL_CELL:
+            fprintf(stream, "cell[%" PRIu64 "]", node.ports[1]);
+            continue;
+        default: break;
+        }
+
+        if (!IS_DUPLICATOR(node.ports[-1])) {
+            // Other symbols must be already removed at this point.
+            panic("Unexpected node symbol!: %s", print_symbol(node.ports[-1]));
+        }
+
+        bool found = false;
+        for (uint8_t k = 1, l = 2; k <= 2 && !found; k++, l--) {
+            const struct node neighbour = follow_port(&node.ports[k]);
+            if (SYMBOL_ERASER == neighbour.ports[-1]) {
+                PUSH_NODE(follow_port(&node.ports[l]), item.i);
+                found = true;
+            }
+        }
+
+        if (!found) { COMPILER_UNREACHABLE(); }
     }
 
-    if (!IS_DUPLICATOR(node.ports[-1])) {
-        // Other symbols must be already removed at this point.
-        panic("Unexpected node symbol!: %s", print_symbol(node.ports[-1]));
+#undef PUSH_NODE
+#undef PUSH_TEXT
+
+    free_work_stack(&stack);
+}
+
+// Term builders
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+struct term_chunk {
+    struct term_chunk *next;
+    size_t nwords, nused;
+    uint64_t words[];
+};
+
+#define TERM_CHUNK_NWORDS (UINT64_C(1) << 13) // 64 KB
+
+struct optiscope_term_builder {
+    struct term_chunk *chunks; // the current chunk first
+};
+
+// The builder used by the term constructors of the current thread; if `NULL`,
+// each term object is allocated separately.
+static COMPILER_THREAD_LOCAL struct optiscope_term_builder *current_builder =
+    NULL;
+
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_COLD //
+extern struct optiscope_term_builder *
+optiscope_open_term_builder(void) {
+    debug("%s()", __func__);
+
+    struct optiscope_term_builder *const builder = xmalloc(sizeof *builder);
+    builder->chunks = NULL;
+
+    return builder;
+}
+
+COMPILER_COLD //
+extern void
+optiscope_use_term_builder(struct optiscope_term_builder *const builder) {
+    debug("%s(%p)", __func__, (void *)builder);
+
+    current_builder = builder;
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+extern void
+optiscope_close_term_builder(struct optiscope_term_builder *const builder) {
+    debug("%s(%p)", __func__, (void *)builder);
+
+    MY_ASSERT(builder);
+
+    if (builder == current_builder) { current_builder = NULL; }
+
+    struct term_chunk *chunk = builder->chunks;
+    while (chunk) {
+        struct term_chunk *const next = chunk->next;
+        free(chunk);
+        chunk = next;
     }
 
-    for (uint8_t k = 1, l = 2; k <= 2; k++, l--) {
-        const struct node neighbour = follow_port(&node.ports[k]);
-        if (SYMBOL_ERASER == neighbour.ports[-1]) {
-            const struct node body = follow_port(&node.ports[l]);
-            to_lambda_string(stream, i, body);
-            return;
-        }
+    free(builder);
+}
+
+// Allocate `size` bytes from the current builder, if any.
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT //
+static void *
+alloc_term_memory(const size_t size) {
+    XASSERT(size > 0);
+
+    struct optiscope_term_builder *const builder = current_builder;
+    if (NULL == builder) { return xmalloc(size); }
+
+    const size_t nwords = (size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    struct term_chunk *chunk = builder->chunks;
+    if (NULL == chunk || chunk->nwords - chunk->nused < nwords) {
+        const size_t chunk_nwords =
+            nwords > TERM_CHUNK_NWORDS ? nwords : TERM_CHUNK_NWORDS;
+        chunk = xmalloc(sizeof *chunk + sizeof(uint64_t) * chunk_nwords);
+        chunk->next = builder->chunks;
+        chunk->nwords = chunk_nwords;
+        chunk->nused = 0;
+        builder->chunks = chunk;
     }
 
-    COMPILER_UNREACHABLE();
+    uint64_t *const object = &chunk->words[chunk->nused];
+    chunk->nused += nwords;
+
+    return object;
 }
 
 // The lambda term interface
@@ -3675,6 +5107,8 @@ enum lambda_term_type {
     LAMBDA_TERM_IF_THEN_ELSE,
     LAMBDA_TERM_FIX,
     LAMBDA_TERM_PERFORM,
+    LAMBDA_TERM_IMAGE,
+    LAMBDA_TERM_SOURCE,
 };
 
 struct apply_data {
@@ -3690,6 +5124,9 @@ struct lambda_data {
     uint64_t **dup_ports; // the pointer to the next duplicator tree
                           // port; dynamically assigned
     uint64_t lvl;         // the de Bruijn level; dynamically assigned
+    bool is_closed; // whether the lambda body refers onely to the binders
+                    // inside the lambda; assigned by `analyze_lambda_term`
+    bool in_arena;  // whether the data is owned by a term builder
 };
 
 struct unary_call_data {
@@ -3725,19 +5162,48 @@ union lambda_term_data {
     struct if_then_else_data ite;
     struct fix_data fix;
     struct perform_data perform;
+    struct term_image *image;
+    struct term_source *source;
 };
 
 struct lambda_term {
     enum lambda_term_type ty;
+    bool in_arena; // whether the term object is owned by a term builder
     union lambda_term_data data;
 };
 
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT //
+static struct lambda_term *
+alloc_term(const enum lambda_term_type ty) {
+    struct lambda_term *const term = alloc_term_memory(sizeof *term);
+    term->ty = ty;
+    term->in_arena = NULL != current_builder;
+
+    return term;
+}
+
+// Deallocate `term`, unlesse it is owned by a term builder.
+COMPILER_NONNULL(1) //
+inline static void
+free_term(struct lambda_term *const restrict term) {
+    MY_ASSERT(term);
+
+    if (!term->in_arena) { free(term); }
+}
+
+COMPILER_NONNULL(1) //
+inline static void
+free_lambda_data(struct lambda_data *const restrict lambda) {
+    MY_ASSERT(lambda);
+
+    if (!lambda->in_arena) { free(lambda); }
+}
+
 extern LambdaTerm
 apply(const restrict LambdaTerm rator, const restrict LambdaTerm rand) {
     MY_ASSERT(rator), MY_ASSERT(rand);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_APPLY;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_APPLY);
     term->data.apply.rator = rator;
     term->data.apply.rand = rand;
 
@@ -3746,10 +5212,11 @@ apply(const restrict LambdaTerm rator, const restrict LambdaTerm rand) {
 
 extern LambdaTerm
 prelambda(void) {
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_LAMBDA;
-    term->data.lambda = xcalloc(1, sizeof *term->data.lambda);
-    // All the data fields are zeroed out.
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_LAMBDA);
+    term->data.lambda = alloc_term_memory(sizeof *term->data.lambda);
+    memset(term->data.lambda, 0, sizeof *term->data.lambda);
+    // All the data fields are zeroed out, save for the ownership.
+    term->data.lambda->in_arena = term->in_arena;
 
     return term;
 }
@@ -3770,8 +5237,7 @@ var(const restrict LambdaTerm binder) {
     MY_ASSERT(binder);
     MY_ASSERT(LAMBDA_TERM_LAMBDA == binder->ty);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_VAR;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_VAR);
     term->data.var = &binder->data.lambda;
 
     binder->data.lambda->nusages++;
@@ -3782,8 +5248,7 @@ var(const restrict LambdaTerm binder) {
 
 extern LambdaTerm
 cell(const uint64_t value) {
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_CELL;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_CELL);
     term->data.cell = value;
 
     return term;
@@ -3795,8 +5260,7 @@ unary_call(
     MY_ASSERT(function);
     MY_ASSERT(rand);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_UNARY_CALL;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_UNARY_CALL);
     term->data.u_call.function = function;
     term->data.u_call.rand = rand;
 
@@ -3811,8 +5275,7 @@ binary_call(
     MY_ASSERT(function);
     MY_ASSERT(lhs), MY_ASSERT(rhs);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_BINARY_CALL;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_BINARY_CALL);
     term->data.b_call.function = function;
     term->data.b_call.lhs = lhs;
     term->data.b_call.rhs = rhs;
@@ -3828,8 +5291,7 @@ if_then_else(
     MY_ASSERT(condition);
     MY_ASSERT(if_then), MY_ASSERT(if_else);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_IF_THEN_ELSE;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_IF_THEN_ELSE);
     term->data.ite.condition = condition;
     term->data.ite.if_then = if_then;
     term->data.ite.if_else = if_else;
@@ -3841,8 +5303,7 @@ extern LambdaTerm
 fix(const restrict LambdaTerm f) {
     MY_ASSERT(f);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_FIX;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_FIX);
     term->data.fix.f = f;
 
     return term;
@@ -3852,8 +5313,7 @@ extern LambdaTerm
 perform(const restrict LambdaTerm action, const restrict LambdaTerm k) {
     MY_ASSERT(action), MY_ASSERT(k);
 
-    struct lambda_term *const term = xmalloc(sizeof *term);
-    term->ty = LAMBDA_TERM_PERFORM;
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_PERFORM);
     term->data.perform.action = action;
     term->data.perform.k = k;
 
@@ -3886,33 +5346,123 @@ is_eta_reducible(
            1 == lambda->nusages;
 }
 
+enum closedness_step {
+    VISIT_TERM,
+    // All the variables of the lambda body have been visited.
+    LEAVE_LAMBDA,
+};
+
+struct closedness_item {
+    enum closedness_step step;
+    struct lambda_term *term;
+};
+
 COMPILER_PURE COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
-static uint64_t
-fv_count(struct lambda_term *const restrict term) {
+inline static bool
+is_linear_lambda(const struct lambda_term *const restrict rator) {
+    MY_ASSERT(rator);
+
+    return LAMBDA_TERM_LAMBDA == rator->ty && 1 == rator->data.lambda->nusages;
+}
+
+// Substitute the operands of linear lambdas & decide which lambdas of `term`
+// are closed in a single pass, instead of counting the free variables of each
+// lambda separately (which is quadratic for nested lambdas). Each open lambda
+// keepes the lowest de Bruijn level its body refers to; a lambda is closed if
+// this level is not lesse than its own.
+COMPILER_NONNULL(1) //
+static void
+analyze_lambda_term(struct lambda_term *const restrict term) {
     MY_ASSERT(term);
 
-    switch (term->ty) {
-    case LAMBDA_TERM_APPLY:
-        return fv_count(term->data.apply.rator) +
-               fv_count(term->data.apply.rand);
-    case LAMBDA_TERM_LAMBDA:
-        return fv_count(term->data.lambda->body) - term->data.lambda->nusages;
-    case LAMBDA_TERM_VAR: return 1;
-    case LAMBDA_TERM_CELL: return 0;
-    case LAMBDA_TERM_UNARY_CALL: return fv_count(term->data.u_call.rand);
-    case LAMBDA_TERM_BINARY_CALL:
-        return fv_count(term->data.b_call.lhs) +
-               fv_count(term->data.b_call.rhs);
-    case LAMBDA_TERM_IF_THEN_ELSE:
-        return fv_count(term->data.ite.condition) +
-               fv_count(term->data.ite.if_then) +
-               fv_count(term->data.ite.if_else);
-    case LAMBDA_TERM_FIX: return fv_count(term->data.fix.f);
-    case LAMBDA_TERM_PERFORM:
-        return fv_count(term->data.perform.action) +
-               fv_count(term->data.perform.k);
-    default: COMPILER_UNREACHABLE();
+    struct work_stack stack = alloc_work_stack(sizeof(struct closedness_item));
+    // The lowest referred levels of the lambdas being visited, innermost last.
+    struct work_stack lambdas = alloc_work_stack(sizeof(uint64_t));
+
+#define PUSH(subterm)                                                          \
+    PUSH_WORK(&stack, struct closedness_item, VISIT_TERM, (subterm))
+
+    PUSH(term);
+
+    while (stack.count > 0) {
+        const struct closedness_item item =
+            *(struct closedness_item *)pop_work(&stack);
+        struct lambda_term *const subterm = item.term;
+        XASSERT(subterm);
+
+        if (LEAVE_LAMBDA == item.step) {
+            const uint64_t min_lvl = *(uint64_t *)pop_work(&lambdas);
+            struct lambda_data *const lambda = subterm->data.lambda;
+            lambda->is_closed = min_lvl >= lambda->lvl;
+            if (lambdas.count > 0) {
+                uint64_t *const outer_min_lvl = peek_work(&lambdas);
+                if (min_lvl < *outer_min_lvl) { *outer_min_lvl = min_lvl; }
+            }
+            continue;
+        }
+
+        switch (subterm->ty) {
+        case LAMBDA_TERM_APPLY: {
+            struct lambda_term *const rator = subterm->data.apply.rator, //
+                *const rand = subterm->data.apply.rand;
+            XASSERT(rator), XASSERT(rand);
+
+            if (is_linear_lambda(rator)) {
+                // Optimization: in `((\x. body) rand)`, substitute `rand` into
+                // `body`, if `x` occurs onely once in `body`. This is done
+                // before deciding closedness, for the lambdas of `body` that
+                // refer to `x` may become closed.
+                struct lambda_data *const lambda = rator->data.lambda;
+                if (LAMBDA_TERM_VAR == rand->ty) {
+                    (*rand->data.var)->usage = lambda->usage;
+                }
+                // The usage object keepes its own ownership.
+                const bool in_arena = lambda->usage->in_arena;
+                *lambda->usage = *rand;
+                lambda->usage->in_arena = in_arena;
+                PUSH(lambda->body);
+                break;
+            }
+
+            PUSH(rand), PUSH(rator);
+            break;
+        }
+        case LAMBDA_TERM_LAMBDA:
+            subterm->data.lambda->lvl = lambdas.count;
+            PUSH_WORK(&lambdas, uint64_t, UINT64_MAX);
+            PUSH_WORK(&stack, struct closedness_item, LEAVE_LAMBDA, subterm);
+            PUSH(subterm->data.lambda->body);
+            break;
+        case LAMBDA_TERM_VAR: {
+            XASSERT(lambdas.count > 0);
+            const uint64_t lvl = (*subterm->data.var)->lvl;
+            uint64_t *const min_lvl = peek_work(&lambdas);
+            if (lvl < *min_lvl) { *min_lvl = lvl; }
+            break;
+        }
+        case LAMBDA_TERM_CELL: break;
+        case LAMBDA_TERM_UNARY_CALL: PUSH(subterm->data.u_call.rand); break;
+        case LAMBDA_TERM_BINARY_CALL:
+            PUSH(subterm->data.b_call.rhs), PUSH(subterm->data.b_call.lhs);
+            break;
+        case LAMBDA_TERM_IF_THEN_ELSE:
+            PUSH(subterm->data.ite.if_else), PUSH(subterm->data.ite.if_then);
+            PUSH(subterm->data.ite.condition);
+            break;
+        case LAMBDA_TERM_FIX: PUSH(subterm->data.fix.f); break;
+        case LAMBDA_TERM_PERFORM:
+            PUSH(subterm->data.perform.k), PUSH(subterm->data.perform.action);
+            break;
+        case LAMBDA_TERM_IMAGE: break; // images are always closed
+        case LAMBDA_TERM_SOURCE: break; // so are textual terms
+        default: COMPILER_UNREACHABLE();
+        }
     }
+
+#undef PUSH
+
+    free_work_stack(&lambdas);
+    free_work_stack(&stack);
 }
 
 COMPILER_CONST COMPILER_WARN_UNUSED_RESULT //
@@ -3921,8 +5471,117 @@ de_bruijn_level_to_index(const uint64_t lvl, const uint64_t var) {
     return lvl - var - 1;
 }
 
-COMPILER_NONNULL(1, 2, 3) //
+enum lambda_kind {
+    IDENTITY_LAMBDA,
+    GC_LAMBDA, // a lambda that "garbage-collects" its argument
+    ETA_REDUCIBLE_LAMBDA,
+    RELEVANT_LAMBDA,
+};
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static enum lambda_kind
+classify_lambda(struct lambda_data *const restrict lambda) {
+    MY_ASSERT(lambda);
+    XASSERT(lambda->body);
+
+    if (is_identity_lambda(lambda)) { return IDENTITY_LAMBDA; }
+    if (0 == lambda->nusages) { return GC_LAMBDA; }
+    if (is_eta_reducible(lambda, lambda->body)) { return ETA_REDUCIBLE_LAMBDA; }
+
+    return RELEVANT_LAMBDA;
+}
+
+// Returnes the ports to be connected to the `nusages` variables of the
+// relevant `lambda`, in the order of their occurrence.
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static uint64_t **
+build_binder(
+    struct context *const restrict graph,
+    const struct node lambda,
+    const uint64_t nusages) {
+    MY_ASSERT(graph);
+    XASSERT(lambda.ports);
+    XASSERT(nusages > 0);
+
+    if (1 == nusages) {
+        // This is a linear non-self-referential lambda.
+        uint64_t **const dup_ports = xmalloc(sizeof dup_ports[0] * 1);
+        dup_ports[0] = &lambda.ports[1];
+        return dup_ports;
+    }
+
+    // This is a non-linear lambda that needs a duplicator tree.
+    return build_duplicator_tree(graph, &lambda.ports[1], 0, nusages);
+}
+
+// Connect the `binder_port` of a variable to `output_port`, through a
+// delimiter if the variable is bound by an outer lambda.
+COMPILER_NONNULL(1, 2, 4) //
+static void
+connect_variable(
+    struct context *const restrict graph,
+    uint64_t *const restrict binder_port,
+    const uint64_t idx,
+    uint64_t *const restrict output_port) {
+    MY_ASSERT(graph);
+    MY_ASSERT(binder_port);
+    MY_ASSERT(output_port);
+
+    if (0 == idx) {
+        connect_ports(binder_port, output_port);
+    } else {
+        struct node delim = alloc_node(graph, SYMBOL_DELIMITER(UINT64_C(0)));
+        delim.ports[2] = idx;
+        connect_ports(&delim.ports[0], binder_port);
+        connect_ports(&delim.ports[1], output_port);
+    }
+}
+
+struct term_image;
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) //
+static enum optiscope_status
+of_term_image(
+    struct context *const restrict graph,
+    const struct term_image *const restrict image,
+    uint64_t *const restrict output_port);
+
+COMPILER_NONNULL(1) //
 static void
+release_term_image(struct term_image *const restrict image);
+
+struct term_source;
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) //
+static enum optiscope_status
+of_term_source(
+    struct context *const restrict graph,
+    const struct term_source *const restrict source,
+    uint64_t *const restrict output_port);
+
+enum translation_step {
+    TRANSLATE_TERM,
+    // Deallocate the term after the terms pushed above it are translated,
+    // for their variables might still refer to it.
+    FREE_TERM,
+    // The same, but also deallocate the lambda data & its duplicator ports.
+    FREE_LAMBDA_TERM,
+};
+
+struct translation_item {
+    enum translation_step step;
+    struct lambda_term *term;
+    uint64_t *output_port;
+    uint64_t lvl;
+    uint64_t **dup_ports;
+};
+
+// Returnes `OPTISCOPE_DONE`, or the status with which the translation has been
+// interrupted (see `interrupt_translation`) or `OPTISCOPE_SYNTAX_ERROR` for a
+// malformed textual term; the graph is then left incomplete, but the rest of
+// `term` is released all the same.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) //
+static enum optiscope_status
 of_lambda_term(
     struct context *const restrict graph,
     struct lambda_term *const restrict term,
@@ -3932,219 +5591,1883 @@ of_lambda_term(
     MY_ASSERT(term);
     MY_ASSERT(output_port);
 
-    switch (term->ty) {
-    case LAMBDA_TERM_APPLY: {
-        struct lambda_term *const rator = term->data.apply.rator, //
-            *const rand = term->data.apply.rand;
-        XASSERT(rator), XASSERT(rand);
-
-        const bool is_linear_lambda =
-            LAMBDA_TERM_LAMBDA == rator->ty && 1 == rator->data.lambda->nusages;
-        if (is_linear_lambda) {
-            // Optimization: in `((\x. body) rand)`, substitute `rand` into
-            // `body`, if `x` occurs onely once in `body`.
-            struct lambda_data *const lambda = rator->data.lambda;
-            if (LAMBDA_TERM_VAR == rand->ty) {
-                (*rand->data.var)->usage = lambda->usage;
-            }
-            *lambda->usage = *rand;
-            of_lambda_term(graph, lambda->body, output_port, lvl);
-            free(rator), free(rand);
-            free(lambda);
-            break;
+    analyze_lambda_term(term);
+
+    struct work_stack stack = alloc_work_stack(sizeof(struct translation_item));
+    enum optiscope_status status = OPTISCOPE_DONE;
+
+#define PUSH_TERM(term, output_port, lvl)                                      \
+    PUSH_WORK(                                                                 \
+        &stack,                                                                \
+        struct translation_item,                                               \
+        TRANSLATE_TERM,                                                        \
+        (term),                                                                \
+        (output_port),                                                         \
+        (lvl),                                                                 \
+        NULL)
+#define PUSH_FREE(step, term, dup_ports)                                       \
+    PUSH_WORK(                                                                 \
+        &stack, struct translation_item, (step), (term), NULL, 0, (dup_ports))
+
+    // The subterms are pushed in reverse order, so that they are translated
+    // from left to right.
+    PUSH_TERM(term, output_port, lvl);
+
+    while (stack.count > 0) {
+        const struct translation_item item =
+            *(struct translation_item *)pop_work(&stack);
+        struct lambda_term *const term = item.term;
+        uint64_t *const output_port = item.output_port;
+        const uint64_t lvl = item.lvl;
+        XASSERT(term);
+
+        switch (item.step) {
+        case TRANSLATE_TERM: break;
+        case FREE_LAMBDA_TERM:
+            free(item.dup_ports);
+            free_lambda_data(term->data.lambda);
+            // fallthrough
+        case FREE_TERM: free_term(term); continue;
+        default: COMPILER_UNREACHABLE();
         }
 
-        const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
-        connect_ports(&applicator.ports[1], output_port);
-        of_lambda_term(graph, rator, &applicator.ports[0], lvl);
-        of_lambda_term(graph, rand, &applicator.ports[2], lvl);
-
-        break;
-    }
-    case LAMBDA_TERM_LAMBDA: {
-        struct lambda_data *const tlambda = term->data.lambda;
-        struct lambda_term *const body = term->data.lambda->body;
-        XASSERT(tlambda);
-        XASSERT(body);
+        XASSERT(output_port);
+
+        if (OPTISCOPE_DONE == status) { status = interrupt_translation(graph); }
+
+        if (OPTISCOPE_DONE != status) {
+            // Release the term without translating it; the variables are
+            // released onely after their lambdas' data.
+            switch (term->ty) {
+            case LAMBDA_TERM_APPLY:
+                if (is_linear_lambda(term->data.apply.rator)) {
+                    // `rand` has been substituted into the lambda body.
+                    PUSH_FREE(FREE_TERM, term->data.apply.rand, NULL);
+                } else {
+                    PUSH_TERM(term->data.apply.rand, output_port, lvl);
+                }
+                PUSH_TERM(term->data.apply.rator, output_port, lvl);
+                break;
+            case LAMBDA_TERM_LAMBDA:
+                PUSH_FREE(FREE_LAMBDA_TERM, term, NULL);
+                PUSH_TERM(term->data.lambda->body, output_port, lvl);
+                continue;
+            case LAMBDA_TERM_VAR:
+            case LAMBDA_TERM_CELL: break;
+            case LAMBDA_TERM_UNARY_CALL:
+                PUSH_TERM(term->data.u_call.rand, output_port, lvl);
+                break;
+            case LAMBDA_TERM_BINARY_CALL:
+                PUSH_TERM(term->data.b_call.rhs, output_port, lvl);
+                PUSH_TERM(term->data.b_call.lhs, output_port, lvl);
+                break;
+            case LAMBDA_TERM_IF_THEN_ELSE:
+                PUSH_TERM(term->data.ite.if_else, output_port, lvl);
+                PUSH_TERM(term->data.ite.if_then, output_port, lvl);
+                PUSH_TERM(term->data.ite.condition, output_port, lvl);
+                break;
+            case LAMBDA_TERM_FIX:
+                PUSH_TERM(term->data.fix.f, output_port, lvl);
+                break;
+            case LAMBDA_TERM_PERFORM:
+                PUSH_TERM(term->data.perform.k, output_port, lvl);
+                PUSH_TERM(term->data.perform.action, output_port, lvl);
+                break;
+            case LAMBDA_TERM_IMAGE: release_term_image(term->data.image); break;
+            case LAMBDA_TERM_SOURCE: free(term->data.source); break;
+            default: COMPILER_UNREACHABLE();
+            }
 
-        if (is_identity_lambda(tlambda)) {
-            // clang-format off
-            const struct node lambda = alloc_node(graph, SYMBOL_IDENTITY_LAMBDA);
-            // clang-format on
-            connect_ports(&lambda.ports[0], output_port);
-            free(body);
-            goto done_with_lambda;
+            free_term(term);
+            continue;
         }
 
-        if (0 == tlambda->nusages) {
-            // This is lambda that "garbage-collects" its argument.
-            const struct node lambda = alloc_node(graph, SYMBOL_GC_LAMBDA);
-            of_lambda_term(graph, body, &lambda.ports[1], lvl + 1);
-            connect_ports(&lambda.ports[0], output_port);
-            goto done_with_lambda;
-        }
+        switch (term->ty) {
+        case LAMBDA_TERM_APPLY: {
+            struct lambda_term *const rator = term->data.apply.rator, //
+                *const rand = term->data.apply.rand;
+            XASSERT(rator), XASSERT(rand);
+
+            if (is_linear_lambda(rator)) {
+                // `rand` has been substituted by `analyze_lambda_term`.
+                PUSH_FREE(FREE_TERM, rand, NULL);
+                PUSH_FREE(FREE_LAMBDA_TERM, rator, NULL);
+                PUSH_TERM(rator->data.lambda->body, output_port, lvl);
+                break;
+            }
 
-        if (is_eta_reducible(tlambda, body)) {
-            of_lambda_term(graph, body->data.apply.rator, output_port, lvl);
-            free(body->data.apply.rand);
-            free(body);
-            goto done_with_lambda;
-        }
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            connect_ports(&applicator.ports[1], output_port);
+            PUSH_TERM(rand, &applicator.ports[2], lvl);
+            PUSH_TERM(rator, &applicator.ports[0], lvl);
 
-        const uint64_t symbol =
-            fv_count(term) > 0 ? SYMBOL_LAMBDA : SYMBOL_LAMBDA_C;
+            break;
+        }
+        case LAMBDA_TERM_LAMBDA: {
+            struct lambda_data *const tlambda = term->data.lambda;
+            struct lambda_term *const body = term->data.lambda->body;
+            XASSERT(tlambda);
+            XASSERT(body);
+
+            switch (classify_lambda(tlambda)) {
+            case IDENTITY_LAMBDA: {
+                // clang-format off
+                const struct node lambda = alloc_node(graph, SYMBOL_IDENTITY_LAMBDA);
+                // clang-format on
+                connect_ports(&lambda.ports[0], output_port);
+                free_term(body);
+                free_lambda_data(tlambda);
+                break;
+            }
+            case GC_LAMBDA: {
+                const struct node lambda = alloc_node(graph, SYMBOL_GC_LAMBDA);
+                connect_ports(&lambda.ports[0], output_port);
+                PUSH_FREE(FREE_LAMBDA_TERM, term, NULL);
+                PUSH_TERM(body, &lambda.ports[1], lvl + 1);
+                continue;
+            }
+            case ETA_REDUCIBLE_LAMBDA:
+                PUSH_FREE(FREE_LAMBDA_TERM, term, NULL);
+                PUSH_FREE(FREE_TERM, body, NULL);
+                PUSH_FREE(FREE_TERM, body->data.apply.rand, NULL);
+                PUSH_TERM(body->data.apply.rator, output_port, lvl);
+                continue;
+            case RELEVANT_LAMBDA: {
+                const uint64_t symbol =
+                    tlambda->is_closed ? SYMBOL_LAMBDA_C : SYMBOL_LAMBDA;
+
+                const struct node lambda = alloc_node(graph, symbol);
+                connect_ports(&lambda.ports[0], output_port);
+                uint64_t **const dup_ports =
+                    build_binder(graph, lambda, tlambda->nusages);
+                tlambda->dup_ports = dup_ports;
+                tlambda->lvl = lvl;
+                PUSH_FREE(FREE_LAMBDA_TERM, term, dup_ports);
+                PUSH_TERM(body, &lambda.ports[2], lvl + 1);
+                continue;
+            }
+            default: COMPILER_UNREACHABLE();
+            }
 
-        const struct node lambda = alloc_node(graph, symbol);
-        connect_ports(&lambda.ports[0], output_port);
-        uint64_t **dup_ports = NULL;
-        if (1 == tlambda->nusages) {
-            // This is a linear non-self-referential lambda.
-            dup_ports = xmalloc(sizeof dup_ports[0] * 1);
-            dup_ports[0] = &lambda.ports[1];
-        } else {
-            // This is a non-linear lambda that needs a duplicator tree.
-            dup_ports = build_duplicator_tree(
-                graph, &lambda.ports[1], 0, tlambda->nusages /* >= 2 */);
+            break;
         }
-        tlambda->dup_ports = dup_ports;
-        tlambda->lvl = lvl;
-        of_lambda_term(graph, body, &lambda.ports[2], lvl + 1);
-        free(dup_ports);
+        case LAMBDA_TERM_VAR: {
+            struct lambda_data *const lambda = *term->data.var;
+            XASSERT(lambda), XASSERT(lambda->dup_ports);
 
-    done_with_lambda:
-        free(tlambda);
-        break;
-    }
-    case LAMBDA_TERM_VAR: {
-        struct lambda_data *const lambda = *term->data.var;
-        XASSERT(lambda), XASSERT(lambda->dup_ports);
+            connect_variable(
+                graph,
+                lambda->dup_ports[0],
+                de_bruijn_level_to_index(lvl, lambda->lvl),
+                output_port);
+            lambda->dup_ports++;
 
-        const uint64_t idx = de_bruijn_level_to_index(lvl, lambda->lvl);
-        if (0 == idx) {
-            connect_ports(lambda->dup_ports[0], output_port);
-        } else {
-            struct node delim =
-                alloc_node(graph, SYMBOL_DELIMITER(UINT64_C(0)));
-            delim.ports[2] = idx;
-            connect_ports(&delim.ports[0], lambda->dup_ports[0]);
-            connect_ports(&delim.ports[1], output_port);
+            break;
         }
-        lambda->dup_ports++;
-
-        break;
-    }
-    case LAMBDA_TERM_CELL: {
-        const uint64_t value = term->data.cell;
+        case LAMBDA_TERM_CELL: {
+            const uint64_t value = term->data.cell;
 
-        const struct node cell = alloc_node(graph, SYMBOL_CELL);
-        connect_ports(&cell.ports[0], output_port);
-        cell.ports[1] = value;
+            const struct node cell = alloc_node(graph, SYMBOL_CELL);
+            connect_ports(&cell.ports[0], output_port);
+            cell.ports[1] = value;
 
-        break;
-    }
-    case LAMBDA_TERM_UNARY_CALL: {
-        uint64_t (*const function)(uint64_t) = term->data.u_call.function;
-        struct lambda_term *const rand = term->data.u_call.rand;
-        XASSERT(function);
-        XASSERT(rand);
-
-        const struct node call = alloc_node(graph, SYMBOL_UNARY_CALL);
-        connect_ports(&call.ports[1], output_port);
+            break;
+        }
+        case LAMBDA_TERM_UNARY_CALL: {
+            uint64_t (*const function)(uint64_t) = term->data.u_call.function;
+            struct lambda_term *const rand = term->data.u_call.rand;
+            XASSERT(function);
+            XASSERT(rand);
+
+            const struct node call = alloc_node(graph, SYMBOL_UNARY_CALL);
+            connect_ports(&call.ports[1], output_port);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
-        call.ports[2] = U64_OF_FUNCTION(function);
+            call.ports[2] = U64_OF_FUNCTION(function);
 #pragma GCC diagnostic pop
-        of_lambda_term(graph, rand, &call.ports[0], lvl);
+            PUSH_TERM(rand, &call.ports[0], lvl);
 
-        break;
-    }
-    case LAMBDA_TERM_BINARY_CALL: {
-        uint64_t (*const function)(uint64_t, uint64_t) = //
-            term->data.b_call.function;
-        struct lambda_term *const lhs = term->data.b_call.lhs, //
-            *const rhs = term->data.b_call.rhs;
-        XASSERT(function);
-        XASSERT(lhs), XASSERT(rhs);
-
-        const struct node call = alloc_node(graph, SYMBOL_BINARY_CALL);
-        connect_ports(&call.ports[1], output_port);
+            break;
+        }
+        case LAMBDA_TERM_BINARY_CALL: {
+            uint64_t (*const function)(uint64_t, uint64_t) = //
+                term->data.b_call.function;
+            struct lambda_term *const lhs = term->data.b_call.lhs, //
+                *const rhs = term->data.b_call.rhs;
+            XASSERT(function);
+            XASSERT(lhs), XASSERT(rhs);
+
+            const struct node call = alloc_node(graph, SYMBOL_BINARY_CALL);
+            connect_ports(&call.ports[1], output_port);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
-        call.ports[3] = U64_OF_FUNCTION(function);
+            call.ports[3] = U64_OF_FUNCTION(function);
 #pragma GCC diagnostic pop
-        of_lambda_term(graph, lhs, &call.ports[0], lvl);
-        of_lambda_term(graph, rhs, &call.ports[2], lvl);
+            PUSH_TERM(rhs, &call.ports[2], lvl);
+            PUSH_TERM(lhs, &call.ports[0], lvl);
 
-        break;
-    }
-    case LAMBDA_TERM_IF_THEN_ELSE: {
-        struct lambda_term *const condition = term->data.ite.condition, //
-            *const if_then = term->data.ite.if_then,                    //
-                *const if_else = term->data.ite.if_else;
-        XASSERT(condition);
-        XASSERT(if_then), XASSERT(if_else);
-
-        const struct node ite = alloc_node(graph, SYMBOL_IF_THEN_ELSE);
-        connect_ports(&ite.ports[1], output_port);
-        of_lambda_term(graph, condition, &ite.ports[0], lvl);
-        of_lambda_term(graph, if_then, &ite.ports[3], lvl);
-        of_lambda_term(graph, if_else, &ite.ports[2], lvl);
+            break;
+        }
+        case LAMBDA_TERM_IF_THEN_ELSE: {
+            struct lambda_term *const condition = term->data.ite.condition, //
+                *const if_then = term->data.ite.if_then,                    //
+                    *const if_else = term->data.ite.if_else;
+            XASSERT(condition);
+            XASSERT(if_then), XASSERT(if_else);
+
+            const struct node ite = alloc_node(graph, SYMBOL_IF_THEN_ELSE);
+            connect_ports(&ite.ports[1], output_port);
+            PUSH_TERM(if_else, &ite.ports[2], lvl);
+            PUSH_TERM(if_then, &ite.ports[3], lvl);
+            PUSH_TERM(condition, &ite.ports[0], lvl);
 
-        break;
-    }
-    case LAMBDA_TERM_FIX: {
-        struct lambda_term *const f = term->data.fix.f;
-        XASSERT(f);
+            break;
+        }
+        case LAMBDA_TERM_FIX: {
+            struct lambda_term *const f = term->data.fix.f;
+            XASSERT(f);
 
-        const struct node dup = alloc_node(graph, SYMBOL_DUPLICATOR(0));
-        const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            const struct node dup = alloc_node(graph, SYMBOL_DUPLICATOR(0));
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
 
-        connect_ports(&dup.ports[0], &applicator.ports[1]);
-        connect_ports(&dup.ports[1], output_port);
-        connect_ports(&dup.ports[2], &applicator.ports[2]);
-        of_lambda_term(graph, f, &applicator.ports[0], lvl);
+            connect_ports(&dup.ports[0], &applicator.ports[1]);
+            connect_ports(&dup.ports[1], output_port);
+            connect_ports(&dup.ports[2], &applicator.ports[2]);
+            PUSH_TERM(f, &applicator.ports[0], lvl);
 
-        break;
-    }
-    case LAMBDA_TERM_PERFORM: {
-        struct lambda_term *const action = term->data.perform.action, //
-            *const k = term->data.perform.k;
-        XASSERT(action), XASSERT(k);
+            break;
+        }
+        case LAMBDA_TERM_PERFORM: {
+            struct lambda_term *const action = term->data.perform.action, //
+                *const k = term->data.perform.k;
+            XASSERT(action), XASSERT(k);
 
-        const struct node perform = alloc_node(graph, SYMBOL_PERFORM);
-        connect_ports(&perform.ports[1], output_port);
-        of_lambda_term(graph, action, &perform.ports[0], lvl);
-        of_lambda_term(graph, k, &perform.ports[2], lvl);
+            const struct node perform = alloc_node(graph, SYMBOL_PERFORM);
+            connect_ports(&perform.ports[1], output_port);
+            PUSH_TERM(k, &perform.ports[2], lvl);
+            PUSH_TERM(action, &perform.ports[0], lvl);
 
-        break;
-    }
-    default: COMPILER_UNREACHABLE();
+            break;
+        }
+        case LAMBDA_TERM_IMAGE:
+            status = of_term_image(graph, term->data.image, output_port);
+            release_term_image(term->data.image);
+            break;
+        case LAMBDA_TERM_SOURCE:
+            status = of_term_source(graph, term->data.source, output_port);
+            free(term->data.source);
+            break;
+        default: COMPILER_UNREACHABLE();
+        }
+
+        // The subterms doe not refer to the term object itself, save for the
+        // variables of a lambda, which is deallocated by `FREE_LAMBDA_TERM`.
+        free_term(term);
     }
 
-    // This function takes ownership of the whole `term` object.
-    free(term);
-}
+#undef PUSH_FREE
+#undef PUSH_TERM
 
-// The complete algorithm
-// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+    free_work_stack(&stack);
 
-COMPILER_NONNULL(1) //
-static void
-weak_reduction(struct context *const restrict graph) {
-    debug("%s()", __func__);
+    return status;
+}
 
-    MY_ASSERT(graph);
+// Binary term images
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
-    struct multifocus *stack = alloc_focus(OPTISCOPE_MULTIFOCUS_COUNT);
+// A binary term image is a sequence of little-endian 64-bit words: the magic
+// number, the format version, the number of the term words, & the term words
+// themselves. The term words encode the term as translated (i.e., after the
+// linear lambdas are substituted & the lambdas are classified) in prefix
+// order; see `README.md` for the detailed description.
+
+#define IMAGE_MAGIC         UINT64_C(0x504f43534954504f) // "OPTISCOP"
+#define IMAGE_VERSION       UINT64_C(1)
+#define IMAGE_HEADER_NWORDS 3
+
+enum image_tag {
+    IMAGE_APPLY = 0,            // rator, rand
+    IMAGE_LAMBDA = 1,           // the number of usages; body
+    IMAGE_LAMBDA_C = 2,         // the same for a closed lambda
+    IMAGE_GC_LAMBDA = 3,        // body
+    IMAGE_IDENTITY_LAMBDA = 4,  // -
+    IMAGE_VAR = 5,              // the de Bruijn index
+    IMAGE_CELL = 6,             // the value in the next word
+    IMAGE_UNARY_CALL = 7,       // the function index; rand
+    IMAGE_BINARY_CALL = 8,      // the function index; lhs, rhs
+    IMAGE_IF_THEN_ELSE = 9,     // condition, if_then, if_else
+    IMAGE_FIX = 10,             // f
+    IMAGE_PERFORM = 11,         // action, k
+};
 
-    struct node f = graph->root;
+// Each term word keepes the tag in its least significant byte & the operand
+// in the rest.
+#define IMAGE_TAG_BITS 8
+#define IMAGE_WORD(tag, operand)                                               \
+    ((uint64_t)(operand) << IMAGE_TAG_BITS | (uint64_t)(tag))
+#define IMAGE_TAG(word)     ((word) & ((UINT64_C(1) << IMAGE_TAG_BITS) - 1))
+#define IMAGE_OPERAND(word) ((word) >> IMAGE_TAG_BITS)
+#define MAX_IMAGE_OPERAND   (UINT64_MAX >> IMAGE_TAG_BITS)
+
+struct term_image {
+    const uint64_t *words; // the term words
+    uint64_t nwords;
+    void *mapping; // the whole file
+    size_t mapping_size;
+    const struct optiscope_registry *registry;
+};
 
-    while (!graph->time_to_stop) {
+// Convert a little-endian word to the host byte order & vice versa.
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT //
+inline static uint64_t
+little_endian(const uint64_t word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return __builtin_bswap64(word);
+#else
+    return word;
+#endif
+}
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static uint64_t
+unary_function_index(
+    const struct optiscope_registry *const restrict registry,
+    uint64_t (*const function)(uint64_t)) {
+    MY_ASSERT(registry);
+    MY_ASSERT(function);
+
+    for (size_t i = 0; i < registry->nunary_functions; i++) {
+        if (function == registry->unary_functions[i]) { return i; }
+    }
+
+    panic("The unary function is not registered!");
+}
+
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static uint64_t
+binary_function_index(
+    const struct optiscope_registry *const restrict registry,
+    uint64_t (*const function)(uint64_t, uint64_t)) {
+    MY_ASSERT(registry);
+    MY_ASSERT(function);
+
+    for (size_t i = 0; i < registry->nbinary_functions; i++) {
+        if (function == registry->binary_functions[i]) { return i; }
+    }
+
+    panic("The binary function is not registered!");
+}
+
+// clang-format off
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) COMPILER_COLD
+// clang-format on
+extern bool
+optiscope_save_term(
+    FILE *const restrict stream,
+    struct lambda_term *const restrict term,
+    const struct optiscope_registry *const restrict registry) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(stream);
+    MY_ASSERT(term);
+    MY_ASSERT(registry);
+
+    analyze_lambda_term(term);
+
+    struct work_stack words = alloc_work_stack(sizeof(uint64_t));
+    struct work_stack stack = alloc_work_stack(sizeof(struct translation_item));
+
+#define EMIT(tag, operand)                                                     \
+    PUSH_WORK(&words, uint64_t, little_endian(IMAGE_WORD((tag), (operand))))
+#define PUSH_TERM(term, lvl)                                                   \
+    PUSH_WORK(                                                                 \
+        &stack,                                                                \
+        struct translation_item,                                               \
+        TRANSLATE_TERM,                                                        \
+        (term),                                                                \
+        NULL,                                                                  \
+        (lvl),                                                                 \
+        NULL)
+#define PUSH_FREE(step, term)                                                  \
+    PUSH_WORK(&stack, struct translation_item, (step), (term), NULL, 0, NULL)
+
+    // The same traversal as in `of_lambda_term`, so that the term words are
+    // in the order in which the nodes would be built.
+    PUSH_TERM(term, 0);
+
+    while (stack.count > 0) {
+        const struct translation_item item =
+            *(struct translation_item *)pop_work(&stack);
+        struct lambda_term *const term = item.term;
+        const uint64_t lvl = item.lvl;
+        XASSERT(term);
+
+        switch (item.step) {
+        case TRANSLATE_TERM: break;
+        case FREE_LAMBDA_TERM:
+            free_lambda_data(term->data.lambda);
+            // fallthrough
+        case FREE_TERM: free_term(term); continue;
+        default: COMPILER_UNREACHABLE();
+        }
+
+        switch (term->ty) {
+        case LAMBDA_TERM_APPLY: {
+            struct lambda_term *const rator = term->data.apply.rator, //
+                *const rand = term->data.apply.rand;
+            XASSERT(rator), XASSERT(rand);
+
+            if (is_linear_lambda(rator)) {
+                PUSH_FREE(FREE_TERM, rand);
+                PUSH_FREE(FREE_LAMBDA_TERM, rator);
+                PUSH_TERM(rator->data.lambda->body, lvl);
+                break;
+            }
+
+            EMIT(IMAGE_APPLY, 0);
+            PUSH_TERM(rand, lvl), PUSH_TERM(rator, lvl);
+            break;
+        }
+        case LAMBDA_TERM_LAMBDA: {
+            struct lambda_data *const tlambda = term->data.lambda;
+            struct lambda_term *const body = tlambda->body;
+            XASSERT(tlambda);
+            XASSERT(body);
+
+            switch (classify_lambda(tlambda)) {
+            case IDENTITY_LAMBDA:
+                EMIT(IMAGE_IDENTITY_LAMBDA, 0);
+                free_term(body);
+                free_lambda_data(tlambda);
+                break;
+            case GC_LAMBDA:
+                EMIT(IMAGE_GC_LAMBDA, 0);
+                PUSH_FREE(FREE_LAMBDA_TERM, term);
+                PUSH_TERM(body, lvl + 1);
+                continue;
+            case ETA_REDUCIBLE_LAMBDA:
+                PUSH_FREE(FREE_LAMBDA_TERM, term);
+                PUSH_FREE(FREE_TERM, body);
+                PUSH_FREE(FREE_TERM, body->data.apply.rand);
+                PUSH_TERM(body->data.apply.rator, lvl);
+                continue;
+            case RELEVANT_LAMBDA:
+                if (tlambda->nusages > MAX_IMAGE_OPERAND) {
+                    panic("Too many lambda parameter usages!");
+                }
+                EMIT(
+                    tlambda->is_closed ? IMAGE_LAMBDA_C : IMAGE_LAMBDA,
+                    tlambda->nusages);
+                tlambda->lvl = lvl;
+                PUSH_FREE(FREE_LAMBDA_TERM, term);
+                PUSH_TERM(body, lvl + 1);
+                continue;
+            default: COMPILER_UNREACHABLE();
+            }
+
+            break;
+        }
+        case LAMBDA_TERM_VAR:
+            EMIT(
+                IMAGE_VAR,
+                de_bruijn_level_to_index(lvl, (*term->data.var)->lvl));
+            break;
+        case LAMBDA_TERM_CELL:
+            EMIT(IMAGE_CELL, 0);
+            PUSH_WORK(&words, uint64_t, little_endian(term->data.cell));
+            break;
+        case LAMBDA_TERM_UNARY_CALL:
+            EMIT(
+                IMAGE_UNARY_CALL,
+                unary_function_index(registry, term->data.u_call.function));
+            PUSH_TERM(term->data.u_call.rand, lvl);
+            break;
+        case LAMBDA_TERM_BINARY_CALL:
+            EMIT(
+                IMAGE_BINARY_CALL,
+                binary_function_index(registry, term->data.b_call.function));
+            PUSH_TERM(term->data.b_call.rhs, lvl);
+            PUSH_TERM(term->data.b_call.lhs, lvl);
+            break;
+        case LAMBDA_TERM_IF_THEN_ELSE:
+            EMIT(IMAGE_IF_THEN_ELSE, 0);
+            PUSH_TERM(term->data.ite.if_else, lvl);
+            PUSH_TERM(term->data.ite.if_then, lvl);
+            PUSH_TERM(term->data.ite.condition, lvl);
+            break;
+        case LAMBDA_TERM_FIX:
+            EMIT(IMAGE_FIX, 0);
+            PUSH_TERM(term->data.fix.f, lvl);
+            break;
+        case LAMBDA_TERM_PERFORM:
+            EMIT(IMAGE_PERFORM, 0);
+            PUSH_TERM(term->data.perform.k, lvl);
+            PUSH_TERM(term->data.perform.action, lvl);
+            break;
+        case LAMBDA_TERM_IMAGE: {
+            // The term words of an image are position-independent, so they
+            // can be copied as they are, provided that the function indices
+            // mean the same.
+            struct term_image *const image = term->data.image;
+            if (registry != image->registry) {
+                panic("The image was loaded with another registry!");
+            }
+            for (uint64_t i = 0; i < image->nwords; i++) {
+                PUSH_WORK(&words, uint64_t, image->words[i]);
+            }
+            release_term_image(image);
+            break;
+        }
+        case LAMBDA_TERM_SOURCE:
+            panic("A textual term cannot be saved before it is run!");
+        default: COMPILER_UNREACHABLE();
+        }
+
+        free_term(term);
+    }
+
+#undef PUSH_FREE
+#undef PUSH_TERM
+#undef EMIT
+
+    free_work_stack(&stack);
+
+    const uint64_t header[IMAGE_HEADER_NWORDS] = {
+        little_endian(IMAGE_MAGIC),
+        little_endian(IMAGE_VERSION),
+        little_endian(words.count),
+    };
+    const bool ok =
+        IMAGE_HEADER_NWORDS ==
+            fwrite(header, sizeof header[0], IMAGE_HEADER_NWORDS, stream) &&
+        words.count ==
+            fwrite(words.items, sizeof(uint64_t), words.count, stream) &&
+        0 == fflush(stream);
+
+    free_work_stack(&words);
+
+    return ok;
+}
+
+// The lowest de Bruijn level referred to by the body of a lambda being
+// checked, & the number of its usages yet to be seen.
+struct image_binder_check {
+    uint64_t min_lvl, nusages_left;
+    bool is_closed;
+};
+
+// Check that the term words are well-formed, so that they can be translated
+// without further checks.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 3) COMPILER_COLD //
+static bool
+check_term_image(
+    const uint64_t *const restrict words,
+    const uint64_t nwords,
+    const struct optiscope_registry *const restrict registry) {
+    MY_ASSERT(words);
+    MY_ASSERT(registry);
+
+    struct work_stack stack = alloc_work_stack(sizeof(enum closedness_step));
+    struct work_stack binders =
+        alloc_work_stack(sizeof(struct image_binder_check));
+    uint64_t i = 0;
+    bool ok = true;
+
+#define PUSH(step)        PUSH_WORK(&stack, enum closedness_step, (step))
+#define PUSH_TERMS(n)     for (int j = 0; j < (n); j++) { PUSH(VISIT_TERM); }
+#define PUSH_BINDER(n, c)                                                      \
+    (PUSH_WORK(                                                                \
+         &binders, struct image_binder_check, UINT64_MAX, (n), (c)),           \
+     PUSH(LEAVE_LAMBDA),                                                       \
+     PUSH(VISIT_TERM))
+#define CHECK(condition)                                                       \
+    if (!(condition)) {                                                        \
+        ok = false;                                                            \
+        break;                                                                 \
+    }
+
+    PUSH(VISIT_TERM);
+
+    while (stack.count > 0) {
+        if (LEAVE_LAMBDA == *(enum closedness_step *)pop_work(&stack)) {
+            const struct image_binder_check binder =
+                *(struct image_binder_check *)pop_work(&binders);
+            const uint64_t lvl = binders.count;
+            CHECK(0 == binder.nusages_left);
+            CHECK(!binder.is_closed || binder.min_lvl >= lvl);
+            if (binders.count > 0) {
+                struct image_binder_check *const outer = peek_work(&binders);
+                if (binder.min_lvl < outer->min_lvl) {
+                    outer->min_lvl = binder.min_lvl;
+                }
+            }
+            continue;
+        }
+
+        CHECK(i < nwords);
+        const uint64_t word = little_endian(words[i++]);
+        const uint64_t operand = IMAGE_OPERAND(word);
+
+        switch (IMAGE_TAG(word)) {
+        case IMAGE_APPLY: PUSH_TERMS(2); break;
+        case IMAGE_LAMBDA:
+        case IMAGE_LAMBDA_C:
+            CHECK(operand > 0);
+            PUSH_BINDER(operand, IMAGE_LAMBDA_C == IMAGE_TAG(word));
+            break;
+        case IMAGE_GC_LAMBDA: PUSH_BINDER(0, false); break;
+        case IMAGE_IDENTITY_LAMBDA: break;
+        case IMAGE_VAR: {
+            CHECK(operand < binders.count);
+            const uint64_t lvl = binders.count - operand - 1;
+            struct image_binder_check *const binder =
+                (struct image_binder_check *)binders.items + lvl;
+            CHECK(binder->nusages_left > 0);
+            binder->nusages_left--;
+            struct image_binder_check *const inner = peek_work(&binders);
+            if (lvl < inner->min_lvl) { inner->min_lvl = lvl; }
+            break;
+        }
+        case IMAGE_CELL:
+            CHECK(i < nwords);
+            i++;
+            break;
+        case IMAGE_UNARY_CALL:
+            CHECK(operand < registry->nunary_functions);
+            PUSH_TERMS(1);
+            break;
+        case IMAGE_BINARY_CALL:
+            CHECK(operand < registry->nbinary_functions);
+            PUSH_TERMS(2);
+            break;
+        case IMAGE_IF_THEN_ELSE: PUSH_TERMS(3); break;
+        case IMAGE_FIX: PUSH_TERMS(1); break;
+        case IMAGE_PERFORM: PUSH_TERMS(2); break;
+        default: CHECK(false);
+        }
+
+        if (!ok) { break; }
+    }
+
+#undef CHECK
+#undef PUSH_BINDER
+#undef PUSH_TERMS
+#undef PUSH
+
+    free_work_stack(&binders);
+    free_work_stack(&stack);
+
+    return ok && nwords == i;
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+release_term_image(struct term_image *const restrict image) {
+    MY_ASSERT(image);
+
+#ifdef __GNUC__
+    if (0 != munmap(image->mapping, image->mapping_size)) {
+        perror("munmap");
+    }
+#else
+    free(image->mapping);
+#endif
+
+    free(image);
+}
+
+// clang-format off
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) COMPILER_COLD
+// clang-format on
+extern struct lambda_term *
+optiscope_load_term(
+    FILE *const restrict stream,
+    const struct optiscope_registry *const restrict registry) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(stream);
+    MY_ASSERT(registry);
+
+#ifdef __GNUC__
+    const int fd = fileno(stream);
+    struct stat info;
+    if (fd < 0 || 0 != fstat(fd, &info) || info.st_size <= 0) { return NULL; }
+    const size_t size = (size_t)info.st_size;
+    void *const mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == mapping) { return NULL; }
+#else
+    if (0 != fseek(stream, 0, SEEK_END)) { return NULL; }
+    const long end = ftell(stream);
+    if (end <= 0 || 0 != fseek(stream, 0, SEEK_SET)) { return NULL; }
+    const size_t size = (size_t)end;
+    void *const mapping = xmalloc(size);
+    if (size != fread(mapping, 1, size, stream)) {
+        free(mapping);
+        return NULL;
+    }
+#endif
+
+    struct term_image *const image = xmalloc(sizeof *image);
+    const uint64_t *const header = mapping;
+    image->words = header + IMAGE_HEADER_NWORDS;
+    image->nwords = size / sizeof(uint64_t) - IMAGE_HEADER_NWORDS;
+    image->mapping = mapping;
+    image->mapping_size = size;
+    image->registry = registry;
+
+    const bool ok =
+        0 == size % sizeof(uint64_t) &&
+        size / sizeof(uint64_t) > IMAGE_HEADER_NWORDS &&
+        IMAGE_MAGIC == little_endian(header[0]) &&
+        IMAGE_VERSION == little_endian(header[1]) &&
+        image->nwords == little_endian(header[2]) &&
+        check_term_image(image->words, image->nwords, registry);
+    if (!ok) {
+        release_term_image(image);
+        return NULL;
+    }
+
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_IMAGE);
+    term->data.image = image;
+
+    return term;
+}
+
+enum image_step {
+    LOAD_TERM,
+    // The body of the lambda has been loaded.
+    LEAVE_BINDER,
+};
+
+struct image_item {
+    enum image_step step;
+    uint64_t *output_port;
+};
+
+// The ports to be connected to the variables of a lambda being loaded (`NULL`
+// for a lambda that "garbage-collects" its argument).
+struct image_binder {
+    uint64_t **dup_ports, **next_port;
+};
+
+// Build the nodes of the checked `image` right from its term words, without
+// allocating the lambda term objects. Returnes the status with which the
+// translation has been interrupted, if any.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) //
+static enum optiscope_status
+of_term_image(
+    struct context *const restrict graph,
+    const struct term_image *const restrict image,
+    uint64_t *const restrict output_port) {
+    MY_ASSERT(graph);
+    MY_ASSERT(image);
+    MY_ASSERT(output_port);
+
+    const struct optiscope_registry *const registry = image->registry;
+    const uint64_t *const words = image->words;
+    uint64_t i = 0;
+
+    struct work_stack stack = alloc_work_stack(sizeof(struct image_item));
+    struct work_stack binders = alloc_work_stack(sizeof(struct image_binder));
+
+#define PUSH_TERM(output_port)                                                 \
+    PUSH_WORK(&stack, struct image_item, LOAD_TERM, (output_port))
+#define PUSH_BINDER(dup_ports, body_port)                                      \
+    (PUSH_WORK(&binders, struct image_binder, (dup_ports), (dup_ports)),       \
+     PUSH_WORK(&stack, struct image_item, LEAVE_BINDER, NULL),                 \
+     PUSH_TERM((body_port)))
+
+    PUSH_TERM(output_port);
+
+    enum optiscope_status status = OPTISCOPE_DONE;
+
+    while (stack.count > 0) {
+        if (OPTISCOPE_DONE != (status = interrupt_translation(graph))) {
+            while (binders.count > 0) {
+                free(((struct image_binder *)pop_work(&binders))->dup_ports);
+            }
+            break;
+        }
+
+        const struct image_item item = *(struct image_item *)pop_work(&stack);
+        uint64_t *const output_port = item.output_port;
+
+        if (LEAVE_BINDER == item.step) {
+            free(((struct image_binder *)pop_work(&binders))->dup_ports);
+            continue;
+        }
+
+        XASSERT(output_port);
+        XASSERT(i < image->nwords);
+        const uint64_t word = little_endian(words[i++]);
+        const uint64_t operand = IMAGE_OPERAND(word);
+
+        switch (IMAGE_TAG(word)) {
+        case IMAGE_APPLY: {
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            connect_ports(&applicator.ports[1], output_port);
+            PUSH_TERM(&applicator.ports[2]);
+            PUSH_TERM(&applicator.ports[0]);
+            break;
+        }
+        case IMAGE_LAMBDA:
+        case IMAGE_LAMBDA_C: {
+            const uint64_t symbol = IMAGE_LAMBDA_C == IMAGE_TAG(word)
+                                        ? SYMBOL_LAMBDA_C
+                                        : SYMBOL_LAMBDA;
+            const struct node lambda = alloc_node(graph, symbol);
+            connect_ports(&lambda.ports[0], output_port);
+            uint64_t **const dup_ports = build_binder(graph, lambda, operand);
+            PUSH_BINDER(dup_ports, &lambda.ports[2]);
+            break;
+        }
+        case IMAGE_GC_LAMBDA: {
+            const struct node lambda = alloc_node(graph, SYMBOL_GC_LAMBDA);
+            connect_ports(&lambda.ports[0], output_port);
+            PUSH_BINDER(NULL, &lambda.ports[1]);
+            break;
+        }
+        case IMAGE_IDENTITY_LAMBDA: {
+            // clang-format off
+            const struct node lambda = alloc_node(graph, SYMBOL_IDENTITY_LAMBDA);
+            // clang-format on
+            connect_ports(&lambda.ports[0], output_port);
+            break;
+        }
+        case IMAGE_VAR: {
+            struct image_binder *const binder =
+                (struct image_binder *)binders.items +
+                (binders.count - operand - 1);
+            XASSERT(binder->next_port);
+            connect_variable(graph, *binder->next_port++, operand, output_port);
+            break;
+        }
+        case IMAGE_CELL: {
+            const struct node cell = alloc_node(graph, SYMBOL_CELL);
+            connect_ports(&cell.ports[0], output_port);
+            cell.ports[1] = little_endian(words[i++]);
+            break;
+        }
+        case IMAGE_UNARY_CALL: {
+            const struct node call = alloc_node(graph, SYMBOL_UNARY_CALL);
+            connect_ports(&call.ports[1], output_port);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+            call.ports[2] =
+                U64_OF_FUNCTION(registry->unary_functions[operand]);
+#pragma GCC diagnostic pop
+            PUSH_TERM(&call.ports[0]);
+            break;
+        }
+        case IMAGE_BINARY_CALL: {
+            const struct node call = alloc_node(graph, SYMBOL_BINARY_CALL);
+            connect_ports(&call.ports[1], output_port);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+            call.ports[3] =
+                U64_OF_FUNCTION(registry->binary_functions[operand]);
+#pragma GCC diagnostic pop
+            PUSH_TERM(&call.ports[2]);
+            PUSH_TERM(&call.ports[0]);
+            break;
+        }
+        case IMAGE_IF_THEN_ELSE: {
+            const struct node ite = alloc_node(graph, SYMBOL_IF_THEN_ELSE);
+            connect_ports(&ite.ports[1], output_port);
+            PUSH_TERM(&ite.ports[2]);
+            PUSH_TERM(&ite.ports[3]);
+            PUSH_TERM(&ite.ports[0]);
+            break;
+        }
+        case IMAGE_FIX: {
+            const struct node dup = alloc_node(graph, SYMBOL_DUPLICATOR(0));
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            connect_ports(&dup.ports[0], &applicator.ports[1]);
+            connect_ports(&dup.ports[1], output_port);
+            connect_ports(&dup.ports[2], &applicator.ports[2]);
+            PUSH_TERM(&applicator.ports[0]);
+            break;
+        }
+        case IMAGE_PERFORM: {
+            const struct node perform = alloc_node(graph, SYMBOL_PERFORM);
+            connect_ports(&perform.ports[1], output_port);
+            PUSH_TERM(&perform.ports[2]);
+            PUSH_TERM(&perform.ports[0]);
+            break;
+        }
+        default: COMPILER_UNREACHABLE();
+        }
+    }
+
+#undef PUSH_BINDER
+#undef PUSH_TERM
+
+    XASSERT(OPTISCOPE_DONE != status || image->nwords == i);
+
+    free_work_stack(&binders);
+    free_work_stack(&stack);
+
+    return status;
+}
+
+// Textual terms
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+// A textual term is parsed onely when it is translated, & the graph nodes are
+// built right as the parser goes, without allocating the lambda term objects;
+// the parser keepes no more than the currently open constructs & binders. See
+// `README.md` for the syntax.
+
+struct term_source {
+    FILE *stream;
+    const struct optiscope_registry *registry;
+};
+
+enum token {
+    TOKEN_ERROR, // a lexical error has been reported
+    TOKEN_EOF,
+    TOKEN_LPAREN,
+    TOKEN_RPAREN,
+    TOKEN_LAMBDA, // `\` or `λ`
+    TOKEN_DOT,
+    TOKEN_EQUALS,
+    TOKEN_IDENTIFIER,
+    TOKEN_INTEGER,
+    TOKEN_LET,
+    TOKEN_IN,
+    TOKEN_IF,
+    TOKEN_THEN,
+    TOKEN_ELSE,
+    TOKEN_FIX,
+};
+
+// A parsed term whose output port is yet to be connected. A variable bound by
+// the innermost lambda has no port (`NULL`) until it is connected, for onely
+// then the duplicator chain of its `binder` is extended by one usage.
+struct parsed_term {
+    uint64_t *port;
+    size_t binder;
+};
+
+struct parser_binder {
+    size_t name, name_len; // the name in `parser->names`
+    size_t next_in_bucket; // the binder shadowed in the same bucket, if any
+    struct node lambda;    // allocated on the first usage
+    uint64_t min_lvl; // the minimum level of the binders referred to inside
+};
+
+enum parse_step {
+    PARSE_ROOT,
+    // A sequence of applications; the term accumulated so far (if any) & the
+    // arguments of a pending primitive are kept in `parser->terms`.
+    PARSE_APPLY,
+    PARSE_PARENS,
+    PARSE_LAMBDA,
+    PARSE_LET_BOUND,
+    PARSE_LET_BODY,
+    PARSE_IF_CONDITION,
+    PARSE_IF_THEN,
+    PARSE_IF_ELSE,
+    PARSE_FIX,
+};
+
+struct parse_frame {
+    enum parse_step step;
+    // For `PARSE_APPLY`, whether a term has been accumulated; for
+    // `PARSE_LAMBDA`, the number of binders; for `PARSE_LET_BOUND`, the
+    // offset of the bound name in `parser->names`.
+    size_t count;
+    uint64_t arity, nargs; // the pending primitive call, if `arity > 0`
+    size_t primitive;      // the primitive index in the registry
+};
+
+#define PARSER_NBUCKETS (UINT64_C(1) << 12)
+#define NO_BINDER       SIZE_MAX
+
+struct parser {
+    struct context *graph;
+    FILE *stream;
+    const struct optiscope_registry *registry;
+    int c; // the lookahead character
+    uint64_t line, column;
+    enum token token; // the lookahead token
+    uint64_t token_line, token_column;
+    struct work_stack text; // the identifier text, null-terminated
+    uint64_t value;         // the integer value
+    struct work_stack binders, names, frames, terms;
+    size_t *buckets;
+};
+
+COMPILER_NONNULL(1, 2) COMPILER_FORMAT(printf, 2, 3) COMPILER_COLD //
+static void
+syntax_error(
+    const struct parser *const restrict parser,
+    const char format[const restrict],
+    ...) {
+    MY_ASSERT(parser);
+    MY_ASSERT(format);
+
+    fprintf(
+        stderr,
+        "Syntax error at %" PRIu64 ":%" PRIu64 ": ",
+        parser->token_line,
+        parser->token_column);
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+COMPILER_NONNULL(1) //
+inline static void
+next_char(struct parser *const restrict parser) {
+    MY_ASSERT(parser);
+
+    if ('\n' == parser->c) {
+        parser->line++, parser->column = 1;
+    } else {
+        parser->column++;
+    }
+    parser->c = getc(parser->stream);
+}
+
+COMPILER_CONST COMPILER_WARN_UNUSED_RESULT //
+inline static bool
+is_identifier_char(const int c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+           ('0' <= c && c <= '9') || '_' == c || '\'' == c;
+}
+
+COMPILER_NONNULL(1) //
+static void
+next_token(struct parser *const restrict parser) {
+    MY_ASSERT(parser);
+
+    for (;;) {
+        if (' ' == parser->c || '\t' == parser->c || '\n' == parser->c ||
+            '\r' == parser->c) {
+            next_char(parser);
+        } else if ('#' == parser->c) {
+            while ('\n' != parser->c && EOF != parser->c) { next_char(parser); }
+        } else {
+            break;
+        }
+    }
+
+    parser->token_line = parser->line, parser->token_column = parser->column;
+
+    switch (parser->c) {
+    case EOF:
+        if (ferror(parser->stream)) {
+            syntax_error(parser, "Failed to read the input.");
+            parser->token = TOKEN_ERROR;
+        } else {
+            parser->token = TOKEN_EOF;
+        }
+        return;
+    case '(': parser->token = TOKEN_LPAREN; break;
+    case ')': parser->token = TOKEN_RPAREN; break;
+    case '\\': parser->token = TOKEN_LAMBDA; break;
+    case '.': parser->token = TOKEN_DOT; break;
+    case '=': parser->token = TOKEN_EQUALS; break;
+    case 0xCE: // the first byte of `λ` in UTF-8
+        next_char(parser);
+        if (0xBB != parser->c) { goto unexpected; }
+        parser->token = TOKEN_LAMBDA;
+        break;
+    default:
+        if ('0' <= parser->c && parser->c <= '9') {
+            uint64_t value = 0;
+            do {
+                const uint64_t digit = (uint64_t)(parser->c - '0');
+                if (value > (UINT64_MAX - digit) / 10) {
+                    syntax_error(parser, "The integer is too large.");
+                    parser->token = TOKEN_ERROR;
+                    return;
+                }
+                value = value * 10 + digit;
+                next_char(parser);
+            } while ('0' <= parser->c && parser->c <= '9');
+            parser->token = TOKEN_INTEGER, parser->value = value;
+            return;
+        }
+
+        if (is_identifier_char(parser->c) && '\'' != parser->c) {
+            parser->text.count = 0;
+            do {
+                PUSH_WORK(&parser->text, char, (char)parser->c);
+                next_char(parser);
+            } while (is_identifier_char(parser->c));
+            PUSH_WORK(&parser->text, char, '\0');
+
+            static const struct {
+                const char *text;
+                enum token token;
+            } keywords[] = {
+                {"let", TOKEN_LET},   {"in", TOKEN_IN},     {"if", TOKEN_IF},
+                {"then", TOKEN_THEN}, {"else", TOKEN_ELSE}, {"fix", TOKEN_FIX},
+            };
+
+            parser->token = TOKEN_IDENTIFIER;
+            for (size_t i = 0; i < sizeof keywords / sizeof keywords[0]; i++) {
+                if (0 == strcmp(parser->text.items, keywords[i].text)) {
+                    parser->token = keywords[i].token;
+                }
+            }
+            return;
+        }
+
+    unexpected:
+        if (EOF == parser->c) {
+            syntax_error(parser, "Unexpected end of input.");
+        } else {
+            syntax_error(parser, "Unexpected character 0x%02X.", parser->c);
+        }
+        parser->token = TOKEN_ERROR;
+        return;
+    }
+
+    next_char(parser);
+}
+
+COMPILER_PURE COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static uint64_t
+hash_name(const char *const restrict name, const size_t len) {
+    MY_ASSERT(name);
+
+    // The FNV-1a hash.
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * UINT64_C(0x100000001b3);
+    }
+
+    return hash & (PARSER_NBUCKETS - 1);
+}
+
+#define PARSER_BINDER(parser, i)                                               \
+    ((struct parser_binder *)(parser)->binders.items + (i))
+#define POP_TERM()                                                             \
+    (*(struct parsed_term *)pop_work(&parser->terms))
+#define PUSH_TERM(term)                                                        \
+    PUSH_WORK(&parser->terms, struct parsed_term, (term).port, (term).binder)
+#define PUSH_FRAME(step, count)                                                \
+    PUSH_WORK(&parser->frames, struct parse_frame, (step), (count), 0, 0, 0)
+
+// Bind the name that has been pushed to `parser->names` at offset `name`.
+COMPILER_NONNULL(1) //
+static void
+open_binder(struct parser *const restrict parser, const size_t name) {
+    MY_ASSERT(parser);
+    XASSERT(name <= parser->names.count);
+
+    const size_t name_len = parser->names.count - name;
+    const uint64_t bucket = hash_name(parser->names.items + name, name_len);
+
+    PUSH_WORK(
+        &parser->binders,
+        struct parser_binder,
+        .name = name,
+        .name_len = name_len,
+        .next_in_bucket = parser->buckets[bucket],
+        .lambda = {NULL},
+        .min_lvl = UINT64_MAX);
+    parser->buckets[bucket] = parser->binders.count - 1;
+}
+
+COMPILER_PURE COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static size_t
+lookup_binder(
+    const struct parser *const restrict parser,
+    const char *const restrict name) {
+    MY_ASSERT(parser);
+    MY_ASSERT(name);
+
+    const size_t name_len = strlen(name);
+
+    for (size_t i = parser->buckets[hash_name(name, name_len)]; NO_BINDER != i;
+         i = PARSER_BINDER(parser, i)->next_in_bucket) {
+        const struct parser_binder *const binder = PARSER_BINDER(parser, i);
+        if (name_len == binder->name_len &&
+            0 == memcmp(parser->names.items + binder->name, name, name_len)) {
+            return i;
+        }
+    }
+
+    return NO_BINDER;
+}
+
+// Returnes whether `name` is a primitive in the registry, setting its `arity`
+// & `index` if so.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3, 4) //
+static bool
+lookup_primitive(
+    const struct optiscope_registry *const restrict registry,
+    const char *const restrict name,
+    uint64_t *const restrict arity,
+    size_t *const restrict index) {
+    MY_ASSERT(registry);
+    MY_ASSERT(name);
+    MY_ASSERT(arity);
+    MY_ASSERT(index);
+
+    for (size_t i = 0; registry->unary_names && i < registry->nunary_functions;
+         i++) {
+        const char *const primitive = registry->unary_names[i];
+        if (primitive && 0 == strcmp(primitive, name)) {
+            *arity = 1, *index = i;
+            return true;
+        }
+    }
+
+    for (size_t i = 0;
+         registry->binary_names && i < registry->nbinary_functions;
+         i++) {
+        const char *const primitive = registry->binary_names[i];
+        if (primitive && 0 == strcmp(primitive, name)) {
+            *arity = 2, *index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Connect the output of `term` to `port`.
+COMPILER_NONNULL(1, 3) //
+static void
+attach_term(
+    struct parser *const restrict parser,
+    const struct parsed_term term,
+    uint64_t *const restrict port) {
+    MY_ASSERT(parser);
+    MY_ASSERT(port);
+
+    if (term.port) {
+        connect_ports(term.port, port);
+        return;
+    }
+
+    struct parser_binder *const binder = PARSER_BINDER(parser, term.binder);
+
+    if (NULL == binder->lambda.ports) {
+        // The first usage; the symbol is fixed up when the lambda is closed.
+        binder->lambda = alloc_node(parser->graph, SYMBOL_LAMBDA);
+        connect_ports(&binder->lambda.ports[1], port);
+        return;
+    }
+
+    // Extend the duplicator chain just above the binder, just as
+    // `build_duplicator_tree` doe.
+    uint64_t *const usages = DECODE_ADDRESS(binder->lambda.ports[1]);
+    const struct node dup = alloc_node(parser->graph, SYMBOL_DUPLICATOR(0));
+    connect_ports(&dup.ports[2], usages);
+    connect_ports(&dup.ports[1], port);
+    connect_ports(&dup.ports[0], &binder->lambda.ports[1]);
+}
+
+// Close the innermost binder with `body`, returning the resulting lambda.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static struct parsed_term
+close_binder(
+    struct parser *const restrict parser, const struct parsed_term body) {
+    MY_ASSERT(parser);
+    XASSERT(parser->binders.count > 0);
+
+    const size_t lvl = parser->binders.count - 1;
+    const struct parser_binder binder = *PARSER_BINDER(parser, lvl);
+    struct parsed_term result = {NULL, 0};
+
+    if (NULL == body.port && lvl == body.binder) {
+        XASSERT(NULL == binder.lambda.ports);
+        // clang-format off
+        const struct node lambda = alloc_node(parser->graph, SYMBOL_IDENTITY_LAMBDA);
+        // clang-format on
+        result.port = &lambda.ports[0];
+    } else if (NULL == binder.lambda.ports) {
+        const struct node lambda = alloc_node(parser->graph, SYMBOL_GC_LAMBDA);
+        attach_term(parser, body, &lambda.ports[1]);
+        result.port = &lambda.ports[0];
+    } else {
+        const struct node lambda = binder.lambda;
+        attach_term(parser, body, &lambda.ports[2]);
+        if (binder.min_lvl >= lvl) { lambda.ports[-1] = SYMBOL_LAMBDA_C; }
+        result.port = &lambda.ports[0];
+    }
+
+    const uint64_t bucket =
+        hash_name(parser->names.items + binder.name, binder.name_len);
+    XASSERT(lvl == parser->buckets[bucket]);
+    parser->buckets[bucket] = binder.next_in_bucket;
+    parser->names.count = binder.name;
+    parser->binders.count--;
+
+    if (parser->binders.count > 0) {
+        struct parser_binder *const outer = peek_work(&parser->binders);
+        if (binder.min_lvl < outer->min_lvl) {
+            outer->min_lvl = binder.min_lvl;
+        }
+    }
+
+    return result;
+}
+
+// Returnes the usage of the variable bound by `binder`.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static struct parsed_term
+parse_variable(struct parser *const restrict parser, const size_t binder) {
+    MY_ASSERT(parser);
+    XASSERT(binder < parser->binders.count);
+
+    struct parser_binder *const innermost = peek_work(&parser->binders);
+    if (binder < innermost->min_lvl) { innermost->min_lvl = binder; }
+
+    const uint64_t idx = parser->binders.count - 1 - binder;
+    const struct parsed_term usage = {NULL, binder};
+    if (0 == idx) { return usage; }
+
+    struct node delim =
+        alloc_node(parser->graph, SYMBOL_DELIMITER(UINT64_C(0)));
+    delim.ports[2] = idx;
+    attach_term(parser, usage, &delim.ports[0]);
+
+    return (struct parsed_term){&delim.ports[1], 0};
+}
+
+// Add the `term` to the sequence of applications in `frame`.
+COMPILER_NONNULL(1, 2) //
+static void
+apply_term(
+    struct parser *const restrict parser,
+    struct parse_frame *const restrict frame,
+    const struct parsed_term term) {
+    MY_ASSERT(parser);
+    MY_ASSERT(frame);
+    XASSERT(PARSE_APPLY == frame->step);
+
+    struct context *const graph = parser->graph;
+
+    if (frame->arity > 0) {
+        PUSH_TERM(term);
+        if (++frame->nargs < frame->arity) { return; }
+
+        struct node call;
+        if (1 == frame->arity) {
+            call = alloc_node(graph, SYMBOL_UNARY_CALL);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+            call.ports[2] = U64_OF_FUNCTION(
+                parser->registry->unary_functions[frame->primitive]);
+#pragma GCC diagnostic pop
+            attach_term(parser, POP_TERM(), &call.ports[0]);
+        } else {
+            call = alloc_node(graph, SYMBOL_BINARY_CALL);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+            call.ports[3] = U64_OF_FUNCTION(
+                parser->registry->binary_functions[frame->primitive]);
+#pragma GCC diagnostic pop
+            const struct parsed_term rhs = POP_TERM(), lhs = POP_TERM();
+            attach_term(parser, lhs, &call.ports[0]);
+            attach_term(parser, rhs, &call.ports[2]);
+        }
+
+        frame->arity = 0, frame->count = 1;
+        PUSH_WORK(&parser->terms, struct parsed_term, &call.ports[1], 0);
+    } else if (0 == frame->count) {
+        frame->count = 1;
+        PUSH_TERM(term);
+    } else {
+        const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+        attach_term(parser, POP_TERM(), &applicator.ports[0]);
+        attach_term(parser, term, &applicator.ports[2]);
+        PUSH_WORK(&parser->terms, struct parsed_term, &applicator.ports[1], 0);
+    }
+}
+
+// Pass the completed `term` to the enclosing constructs, completing them as
+// well while possible. Returnes `false` on a syntax error.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 3) //
+static bool
+complete_term(
+    struct parser *const restrict parser,
+    struct parsed_term term,
+    uint64_t *const restrict output_port) {
+    MY_ASSERT(parser);
+    MY_ASSERT(output_port);
+
+    struct context *const graph = parser->graph;
+
+#define EXPECT(expected, what)                                                 \
+    do {                                                                       \
+        if ((expected) != parser->token) {                                     \
+            if (TOKEN_ERROR != parser->token) {                                \
+                syntax_error(parser, "Expected %s.", (what));                  \
+            }                                                                  \
+            return false;                                                      \
+        }                                                                      \
+        next_token(parser);                                                    \
+    } while (0)
+
+    for (;;) {
+        struct parse_frame *const frame = peek_work(&parser->frames);
+
+        switch (frame->step) {
+        case PARSE_ROOT:
+            if (TOKEN_EOF != parser->token) {
+                if (TOKEN_ERROR != parser->token) {
+                    syntax_error(parser, "Expected the end of input.");
+                }
+                return false;
+            }
+            attach_term(parser, term, output_port);
+            parser->frames.count--;
+            return true;
+        case PARSE_APPLY: apply_term(parser, frame, term); return true;
+        case PARSE_PARENS:
+            EXPECT(TOKEN_RPAREN, "`)`");
+            parser->frames.count--;
+            break;
+        case PARSE_LAMBDA:
+            for (size_t i = 0; i < frame->count; i++) {
+                term = close_binder(parser, term);
+            }
+            parser->frames.count--;
+            break;
+        case PARSE_LET_BOUND:
+            EXPECT(TOKEN_IN, "`in`");
+            PUSH_TERM(term);
+            open_binder(parser, frame->count);
+            frame->step = PARSE_LET_BODY;
+            PUSH_FRAME(PARSE_APPLY, 0);
+            return true;
+        case PARSE_LET_BODY: {
+            // A `let` is an application of a lambda to the bound term.
+            const struct parsed_term lambda = close_binder(parser, term);
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            attach_term(parser, lambda, &applicator.ports[0]);
+            attach_term(parser, POP_TERM(), &applicator.ports[2]);
+            term = (struct parsed_term){&applicator.ports[1], 0};
+            parser->frames.count--;
+            break;
+        }
+        case PARSE_IF_CONDITION:
+            EXPECT(TOKEN_THEN, "`then`");
+            PUSH_TERM(term);
+            frame->step = PARSE_IF_THEN;
+            PUSH_FRAME(PARSE_APPLY, 0);
+            return true;
+        case PARSE_IF_THEN:
+            EXPECT(TOKEN_ELSE, "`else`");
+            PUSH_TERM(term);
+            frame->step = PARSE_IF_ELSE;
+            PUSH_FRAME(PARSE_APPLY, 0);
+            return true;
+        case PARSE_IF_ELSE: {
+            const struct node ite = alloc_node(graph, SYMBOL_IF_THEN_ELSE);
+            const struct parsed_term if_then = POP_TERM(),
+                                     condition = POP_TERM();
+            attach_term(parser, condition, &ite.ports[0]);
+            attach_term(parser, if_then, &ite.ports[3]);
+            attach_term(parser, term, &ite.ports[2]);
+            term = (struct parsed_term){&ite.ports[1], 0};
+            parser->frames.count--;
+            break;
+        }
+        case PARSE_FIX: {
+            const struct node dup = alloc_node(graph, SYMBOL_DUPLICATOR(0));
+            const struct node applicator = alloc_node(graph, SYMBOL_APPLICATOR);
+            connect_ports(&dup.ports[0], &applicator.ports[1]);
+            connect_ports(&dup.ports[2], &applicator.ports[2]);
+            attach_term(parser, term, &applicator.ports[0]);
+            term = (struct parsed_term){&dup.ports[1], 0};
+            parser->frames.count--;
+            break;
+        }
+        default: COMPILER_UNREACHABLE();
+        }
+    }
+
+#undef EXPECT
+}
+
+// Parse the whole `parser->stream`, connecting the term to `output_port`.
+// Returnes `OPTISCOPE_SYNTAX_ERROR` on a syntax error, or the status with which
+// the translation has been interrupted, if any.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static enum optiscope_status
+parse_term(
+    struct parser *const restrict parser,
+    uint64_t *const restrict output_port) {
+    MY_ASSERT(parser);
+    MY_ASSERT(output_port);
+
+    PUSH_FRAME(PARSE_ROOT, 0);
+    PUSH_FRAME(PARSE_APPLY, 0);
+    next_token(parser);
+
+    while (parser->frames.count > 0) {
+        const enum optiscope_status status =
+            interrupt_translation(parser->graph);
+        if (OPTISCOPE_DONE != status) { return status; }
+
+        struct parse_frame *const frame = peek_work(&parser->frames);
+        XASSERT(PARSE_APPLY == frame->step);
+
+        switch (parser->token) {
+        case TOKEN_ERROR: return OPTISCOPE_SYNTAX_ERROR;
+        case TOKEN_IDENTIFIER: {
+            const char *const name = parser->text.items;
+            const size_t binder = lookup_binder(parser, name);
+            uint64_t arity;
+            size_t primitive;
+
+            if (NO_BINDER != binder) {
+                apply_term(parser, frame, parse_variable(parser, binder));
+            } else if (lookup_primitive(
+                           parser->registry, name, &arity, &primitive)) {
+                if (frame->count > 0 || frame->arity > 0) {
+                    syntax_error(
+                        parser,
+                        "The primitive `%s` must be applied to its %" PRIu64
+                        " argument(s) directly.",
+                        name,
+                        arity);
+                    return OPTISCOPE_SYNTAX_ERROR;
+                }
+                frame->arity = arity, frame->nargs = 0;
+                frame->primitive = primitive;
+            } else {
+                syntax_error(parser, "Unbound variable `%s`.", name);
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            next_token(parser);
+            break;
+        }
+        case TOKEN_INTEGER: {
+            const struct node cell = alloc_node(parser->graph, SYMBOL_CELL);
+            cell.ports[1] = parser->value;
+            apply_term(parser, frame, (struct parsed_term){&cell.ports[0], 0});
+            next_token(parser);
+            break;
+        }
+        case TOKEN_LPAREN:
+            next_token(parser);
+            PUSH_FRAME(PARSE_PARENS, 0);
+            PUSH_FRAME(PARSE_APPLY, 0);
+            break;
+        case TOKEN_LAMBDA: {
+            next_token(parser);
+            size_t count = 0;
+            for (; TOKEN_IDENTIFIER == parser->token; count++) {
+                const size_t name = parser->names.count;
+                for (const char *c = parser->text.items; '\0' != *c; c++) {
+                    PUSH_WORK(&parser->names, char, *c);
+                }
+                open_binder(parser, name);
+                next_token(parser);
+            }
+            if (0 == count || TOKEN_DOT != parser->token) {
+                if (TOKEN_ERROR != parser->token) {
+                    syntax_error(
+                        parser,
+                        0 == count ? "Expected a binder." : "Expected `.`.");
+                }
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            next_token(parser);
+            PUSH_FRAME(PARSE_LAMBDA, count);
+            PUSH_FRAME(PARSE_APPLY, 0);
+            break;
+        }
+        case TOKEN_LET: {
+            next_token(parser);
+            if (TOKEN_IDENTIFIER != parser->token) {
+                if (TOKEN_ERROR != parser->token) {
+                    syntax_error(parser, "Expected a binder.");
+                }
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            // The name is bound onely after the bound term is parsed.
+            const size_t name = parser->names.count;
+            for (const char *c = parser->text.items; '\0' != *c; c++) {
+                PUSH_WORK(&parser->names, char, *c);
+            }
+            next_token(parser);
+            if (TOKEN_EQUALS != parser->token) {
+                if (TOKEN_ERROR != parser->token) {
+                    syntax_error(parser, "Expected `=`.");
+                }
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            next_token(parser);
+            PUSH_FRAME(PARSE_LET_BOUND, name);
+            PUSH_FRAME(PARSE_APPLY, 0);
+            break;
+        }
+        case TOKEN_IF:
+            next_token(parser);
+            PUSH_FRAME(PARSE_IF_CONDITION, 0);
+            PUSH_FRAME(PARSE_APPLY, 0);
+            break;
+        case TOKEN_FIX:
+            next_token(parser);
+            PUSH_FRAME(PARSE_FIX, 0);
+            PUSH_FRAME(PARSE_APPLY, 0);
+            break;
+        default:
+            // The sequence of applications is over.
+            if (frame->arity > 0) {
+                syntax_error(
+                    parser,
+                    "The primitive expects %" PRIu64 " argument(s).",
+                    frame->arity);
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            if (0 == frame->count) {
+                syntax_error(parser, "Expected a term.");
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+            parser->frames.count--;
+            if (!complete_term(parser, POP_TERM(), output_port)) {
+                return OPTISCOPE_SYNTAX_ERROR;
+            }
+        }
+    }
+
+    return OPTISCOPE_DONE;
+}
+
+#undef PUSH_FRAME
+#undef PUSH_TERM
+#undef POP_TERM
+#undef PARSER_BINDER
+
+// Parse the textual term from `source` right into the graph, connecting it to
+// `output_port`. Returnes the status of `parse_term`; a syntax error is
+// reported to `stderr`.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) //
+static enum optiscope_status
+of_term_source(
+    struct context *const restrict graph,
+    const struct term_source *const restrict source,
+    uint64_t *const restrict output_port) {
+    MY_ASSERT(graph);
+    MY_ASSERT(source);
+    MY_ASSERT(output_port);
+
+    struct parser parser = {
+        .graph = graph,
+        .stream = source->stream,
+        .registry = source->registry,
+        .c = getc(source->stream),
+        .line = 1,
+        .column = 1,
+        .token = TOKEN_EOF,
+        .text = alloc_work_stack(sizeof(char)),
+        .binders = alloc_work_stack(sizeof(struct parser_binder)),
+        .names = alloc_work_stack(sizeof(char)),
+        .frames = alloc_work_stack(sizeof(struct parse_frame)),
+        .terms = alloc_work_stack(sizeof(struct parsed_term)),
+        .buckets = xmalloc(sizeof(size_t) * PARSER_NBUCKETS),
+    };
+    for (size_t i = 0; i < PARSER_NBUCKETS; i++) {
+        parser.buckets[i] = NO_BINDER;
+    }
+
+    const enum optiscope_status status = parse_term(&parser, output_port);
+
+    free(parser.buckets);
+    free_work_stack(&parser.terms);
+    free_work_stack(&parser.frames);
+    free_work_stack(&parser.names);
+    free_work_stack(&parser.binders);
+    free_work_stack(&parser.text);
+
+    return status;
+}
+
+// clang-format off
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2)
+COMPILER_COLD
+// clang-format on
+extern struct lambda_term *
+optiscope_parse_term(
+    FILE *const restrict stream,
+    const struct optiscope_registry *const restrict registry) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(stream);
+    MY_ASSERT(registry);
+
+    struct term_source *const source = xmalloc(sizeof *source);
+    source->stream = stream;
+    source->registry = registry;
+
+    struct lambda_term *const term = alloc_term(LAMBDA_TERM_SOURCE);
+    term->data.source = source;
+
+    return term;
+}
+
+#undef NO_BINDER
+#undef PARSER_NBUCKETS
+
+// Graph compaction
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+#ifdef OPTISCOPE_ENABLE_COMPACTION
+
+// Copy the `node` to fresh memory & leave a forwarding address in its principal
+// port. The offset bits of the forwarding port are zero, so that the auxiliary
+// ports of the old node still lead to its principal port.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) COMPILER_COLD //
+static struct node
+relocate_node(
+    struct context *const restrict graph,
+    struct multifocus *const restrict relocated,
+    const struct node node) {
+    MY_ASSERT(graph);
+    MY_ASSERT(relocated);
+    XASSERT(node.ports);
+
+    const uint8_t nwords = node_words(node.ports[-1]);
+
+    uint64_t *ports = NULL;
+    switch (nwords) {
+    case 2: ports = ALLOC_FRESH_POOL_OBJECT(graph->runtime, words2_pool); break;
+    case 3: ports = ALLOC_FRESH_POOL_OBJECT(graph->runtime, words3_pool); break;
+    case 4: ports = ALLOC_FRESH_POOL_OBJECT(graph->runtime, words4_pool); break;
+    case 5: ports = ALLOC_FRESH_POOL_OBJECT(graph->runtime, words5_pool); break;
+    default: COMPILER_UNREACHABLE();
+    }
+
+    memcpy(ports - 1, node.ports - 1, sizeof ports[0] * nwords);
+    node.ports[0] =
+        PORT_VALUE(UINT64_C(0), PHASE_FORWARDED, (uint64_t)&ports[0]);
+
+#ifdef OPTISCOPE_ENABLE_STATS
+    graph->nnodes++, graph->nwords += nwords;
+    if (graph->nnodes > graph->npeak_nodes) {
+        graph->npeak_nodes = graph->nnodes;
+    }
+    if (graph->nwords > graph->npeak_words) {
+        graph->npeak_words = graph->nwords;
+    }
+#endif
+
+    focus_on(graph->stack, (struct node){ports});
+    focus_on(relocated, node);
+
+    return (struct node){ports};
+}
+
+// Return the new address of the `port`, relocating its node if necessary.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2, 3) COMPILER_COLD //
+static uint64_t *
+forward_port(
+    struct context *const restrict graph,
+    struct multifocus *const restrict relocated,
+    uint64_t *const restrict port) {
+    MY_ASSERT(graph);
+    MY_ASSERT(relocated);
+    MY_ASSERT(port);
+
+    const struct node node = node_of_port(port);
+    if (SYMBOL_ROOT == node.ports[-1]) { return port; }
+
+    const struct node forwarded =
+        PHASE_FORWARDED == DECODE_PHASE_METADATA(node.ports[0])
+            ? (struct node){DECODE_ADDRESS(node.ports[0])}
+            : relocate_node(graph, relocated, node);
+
+    return forwarded.ports + (port - node.ports);
+}
+
+// Relocate all the nodes reachable from the root to fresh chunks, in the order
+// of traversal, so that the subsequent phases walk through memory densely.
+// Legal onely when no multifocus refers to the nodes. The copy is charged
+// against the memory limit like any other allocation, so the live graph is
+// briefly held twice; if that exceeds the limit, the reduction is abandoned.
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+compact_graph(struct context *const restrict graph) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(graph);
+    XASSERT(graph->root.ports);
+    XASSERT(0 == graph->stack->count);
+    XASSERT(NULL == graph->relocated);
+
+    // The free lists are shared by all the reductions on the runtime, so they
+    // may not be abandoned while another one is open.
+    if (graph->runtime->nactive_runs > 1) { return; }
+
+    struct multifocus *const relocated = graph->relocated =
+        alloc_focus(graph->runtime, OPTISCOPE_MULTIFOCUS_COUNT);
+
+#define FORWARD(port)                                                          \
+    ((port) = ENCODE_ADDRESS(                                                  \
+         DECODE_ADDRESS_METADATA(port),                                        \
+         (uint64_t)forward_port(graph, relocated, DECODE_ADDRESS(port))))
+
+    FORWARD(graph->root.ports[0]);
+
+    // The stack holds the new nodes whose ports still lead to the old ones.
+    CONSUME_MULTIFOCUS (graph->stack, f) {
+        FOR_ALL_PORTS (f, i, 0) { FORWARD(f.ports[i]); }
+    }
+
+#undef FORWARD
+
+    CONSUME_MULTIFOCUS (relocated, f) { free_node(graph, f); }
+    free_focus(graph->runtime, relocated);
+    graph->relocated = NULL;
+
+    forget_free_lists(graph->runtime);
+}
+
+#else
+
+#define compact_graph(graph) ((void)0)
+
+#endif // OPTISCOPE_ENABLE_COMPACTION
+
+// The complete algorithm
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+// Returnes when either the interface normal form is reached (setting
+// `time_to_stop`) or the fuel runs out, in which case the stack keepes the path
+// to the current node so that the next call resumes from there.
+COMPILER_NONNULL(1) //
+static void
+weak_reduction(struct context *const restrict graph) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(graph);
+    XASSERT(graph->fuel > 0);
+
+#ifdef COMPILER_LABELS_AS_VALUES
+    weak_reduction_threaded(graph);
+#else
+    struct multifocus *const stack = graph->stack;
+
+    struct node f = unfocus_or(stack, graph->root);
+
+    while (!graph->time_to_stop) {
         const struct node g = follow_port(&f.ports[0]);
         XASSERT(g.ports);
 
         if (is_interacting_with(f, g)) {
+#if OPTISCOPE_PREFETCH_DISTANCE > 0
+            // The rule will rewire the principal port of the next node.
+            if (stack->count > 0) {
+                COMPILER_PREFETCH(stack->array[stack->count - 1].ports);
+            }
+#endif
             fire_rule(graph, f, g);
+            if (0 == --graph->fuel && !refuel(graph)) { break; }
             f = unfocus_or(stack, graph->root);
         } else {
             focus_on(stack, f);
@@ -4152,107 +7475,441 @@ weak_reduction(struct context *const restrict graph) {
         }
     }
 
-    free_focus(stack);
+    if (graph->time_to_stop) { stack->count = 0; }
+#endif
+}
+
+COMPILER_NONNULL(1) //
+static void
+forget_active_pairs(struct context *const restrict graph) {
+    MY_ASSERT(graph);
+
+#define X(focus_name) graph->focus_name->count = 0;
+    CONTEXT_MULTIFOCUSES
+#undef X
+
+    graph->lost_pairs = false;
+}
+
+// Collect the active pairs reachable from the root into the multifocuses,
+// dropping the ones that are already there.
+COMPILER_NONNULL(1) //
+static void
+discover_active_pairs(struct context *const restrict graph) {
+    MY_ASSERT(graph);
+
+    forget_active_pairs(graph);
+    graph->nsteps_to_walk = walk_graph(graph, multifocus_cb);
 }
 
+#ifndef NDEBUG
+
 COMPILER_NONNULL(1) //
 static void
+assert_no_active_pair_cb(struct context *const graph, const struct node f) {
+    MY_ASSERT(graph);
+    XASSERT(f.ports);
+
+    const struct node g = follow_port(&f.ports[0]);
+    XASSERT(g.ports);
+
+    MY_ASSERT(is_either_root(f, g) || !is_interacting_with(f, g));
+}
+
+#endif // NDEBUG
+
+// The rules register the active pairs they create, so the graph does not need
+// to be walked after each round of interactions. However, some of these pairs
+// might be disconnected from the root, & garbage must not be reduced forever;
+// hence, we collect the active pairs anew after as many interactions as the
+// graph had nodes, which keepes the cost of walks proportional to the number
+// of interactions. Returnes `false` if the fuel has run out before the graph
+// is normalized.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1) //
+static bool
 normalize_x_rules(struct context *const restrict graph) {
     debug("%s()", __func__);
 
     MY_ASSERT(graph);
+    XASSERT(graph->fuel > 0);
+    MY_ASSERT(PHASE_REDUCE_FULLY == graph->phase);
+
+    for (;;) {
+        if (0 == graph->nsteps_to_walk ||
+            (graph->lost_pairs && is_normalized_graph(graph))) {
+            discover_active_pairs(graph);
+        }
+        if (is_normalized_graph(graph)) { break; }
+
+        const bool drained =
+            interact_all(graph, beta, graph->betas) &&
+            interact_all(graph, beta_c, graph->closed_betas) &&
+            interact_all(graph, identity_beta, graph->identity_betas) &&
+            interact_all(graph, gc_beta, graph->gc_betas) &&
+            interact_all(graph, do_unary_call, graph->unary_calls) &&
+            interact_all(graph, do_binary_call, graph->binary_calls) &&
+            interact_all(graph, do_binary_call_aux, graph->binary_calls_aux) &&
+            interact_all(graph, do_if_then_else, graph->if_then_elses) &&
+            interact_all(graph, do_perform, graph->performs) &&
+            interact_all(graph, annihilate, graph->annihilations) &&
+            interact_all(graph, commute, graph->commutations);
+
+        if (!drained && 0 == graph->fuel) { return false; }
+    }
+
+#ifndef NDEBUG
+    // Validate the incremental discovery of active pairs.
+    walk_graph(graph, assert_no_active_pair_cb);
+#endif
 
-repeat:
-    graph->phase = PHASE_DISCOVER, walk_graph(graph, multifocus_cb);
-    graph->phase = PHASE_REDUCE_FULLY, walk_graph(graph, NULL);
+    return true;
+}
 
-    if (is_normalized_graph(graph)) { return; }
+// Resumable reductions
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
-    // clang-format off
-    CONSUME_MULTIFOCUS (graph->betas, f) { interact(graph, beta, f); }
-    CONSUME_MULTIFOCUS (graph->closed_betas, f) { interact(graph, beta_c, f); }
-    CONSUME_MULTIFOCUS (graph->identity_betas, f) { interact(graph, identity_beta, f); }
-    CONSUME_MULTIFOCUS (graph->gc_betas, f) { interact(graph, gc_beta, f); }
-    CONSUME_MULTIFOCUS (graph->unary_calls, f) { interact(graph, do_unary_call, f); }
-    CONSUME_MULTIFOCUS (graph->binary_calls, f) { interact(graph, do_binary_call, f); }
-    CONSUME_MULTIFOCUS (graph->binary_calls_aux, f) { interact(graph, do_binary_call_aux, f); }
-    CONSUME_MULTIFOCUS (graph->if_then_elses, f) { interact(graph, do_if_then_else, f); }
-    CONSUME_MULTIFOCUS (graph->annihilations, f) { interact(graph, annihilate, f); }
-    CONSUME_MULTIFOCUS (graph->commutations, f) { interact(graph, commute, f); }
-    // clang-format on
+// The stages of the algorithm, in the order of execution. Each stage after
+// weak reduction first transformes the graph by a single walk & then
+// normalizes it, which can be suspended.
+enum reduction_stage {
+    STAGE_WEAK_REDUCTION,
+    STAGE_FULL_REDUCTION,
+    STAGE_UNWINDING,
+    STAGE_SCOPE_REMOVAL,
+    STAGE_LOOP_CUTTING,
+    STAGE_FINISHED,
+};
+
+struct optiscope_reduction {
+    struct context *graph;
+    FILE *stream;
+    enum reduction_stage stage;
+
+    // The term to translate, until it is translated.
+    struct lambda_term *term;
+
+    // Whether the walk of the current stage has been done already.
+    bool walked;
+
+    // The status to report once `STAGE_FINISHED` is reached.
+    enum optiscope_status status;
+};
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+abandon_reduction(
+    struct optiscope_reduction *const restrict reduction,
+    const enum optiscope_status status) {
+    MY_ASSERT(reduction);
 
-    MY_ASSERT(is_normalized_graph(graph));
+    // The graph may be left in an inconsistent state; it cannot be resumed.
+    reduction->stage = STAGE_FINISHED;
+    reduction->status = status;
+}
 
-    goto repeat;
+// Run `action` on `reduction` until its deadline, recording an escape from the
+// reduction (see `escape_reduction`) as its final status.
+COMPILER_NONNULL(1, 2) //
+static void
+run_guarded(
+    struct optiscope_reduction *const restrict reduction,
+    void (*const action)(struct optiscope_reduction *)) {
+    MY_ASSERT(reduction);
+    MY_ASSERT(action);
+
+    struct context *const graph = reduction->graph;
+    struct optiscope_runtime *const runtime = graph->runtime;
+
+    // A nested reduction escapes to its own caller, not to the outer one.
+    jmp_buf escape, *const outer_escape = runtime->memory_source.escape;
+
+    graph->deadline =
+        runtime->timeout_ms > 0
+            ? monotonic_ns() + runtime->timeout_ms * UINT64_C(1000000)
+            : 0;
+
+    runtime->memory_source.escape = &escape;
+    switch (setjmp(escape)) {
+    case 0: action(reduction); break;
+    case OPTISCOPE_OUT_OF_MEMORY:
+        abandon_reduction(reduction, OPTISCOPE_OUT_OF_MEMORY);
+        break;
+    case OPTISCOPE_CANCELLED:
+        // Let the outer reductions (if any) observe the cancellation as well.
+        if (NULL == outer_escape) {
+            COMPILER_ATOMIC_STORE(&runtime->cancelled, 0);
+        }
+        abandon_reduction(reduction, OPTISCOPE_CANCELLED);
+        break;
+    case OPTISCOPE_TIMED_OUT:
+        abandon_reduction(reduction, OPTISCOPE_TIMED_OUT);
+        break;
+    case OPTISCOPE_SYNTAX_ERROR:
+        abandon_reduction(reduction, OPTISCOPE_SYNTAX_ERROR);
+        break;
+    default: COMPILER_UNREACHABLE();
+    }
+    runtime->memory_source.escape = outer_escape;
 }
 
-extern void
-optiscope_algorithm(
+COMPILER_NONNULL(1) COMPILER_COLD //
+static void
+translate_term(struct optiscope_reduction *const restrict reduction) {
+    MY_ASSERT(reduction);
+    XASSERT(reduction->term);
+
+    struct context *const graph = reduction->graph;
+
+    const enum optiscope_status status =
+        of_lambda_term(graph, reduction->term, &graph->root.ports[0], 0);
+    reduction->term = NULL;
+    // Nothing but the graph is held by now, so it is safe to escape.
+    if (OPTISCOPE_DONE != status) { escape_reduction(graph->runtime, status); }
+    graphviz(graph, "target/1-initial.dot");
+}
+
+// clang-format off
+COMPILER_RETURNS_NONNULL COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 3)
+COMPILER_COLD
+// clang-format on
+extern struct optiscope_reduction *
+optiscope_open_reduction_r(
+    struct optiscope_runtime *const restrict runtime, // must not be `NULL`
     FILE *const restrict stream,            // if `NULL`, doe not read back
     struct lambda_term *const restrict term // must not be `NULL`
 ) {
     debug("%s()", __func__);
 
+    MY_ASSERT(runtime);
     MY_ASSERT(term);
 
-    struct context *const graph = alloc_context();
+    runtime->nactive_runs++;
 
-    of_lambda_term(graph, term, &graph->root.ports[0], 0);
+    // Neither the context nor the translation may escape before releasing
+    // their memory, so exceeding the limit is onely recorded until the term is
+    // translated, & reported by `translate_term`.
+    struct memory_source *const source = &runtime->memory_source;
+    const bool deferred = source->deferred, exceeded = source->exceeded;
+    source->deferred = true, source->exceeded = false;
 
-    // Phase #1: weak reduction.
-    {
-        graphviz(graph, "target/1-initial.dot");
+    struct optiscope_reduction *const reduction = xmalloc(sizeof *reduction);
+    reduction->graph = alloc_context(runtime);
+    reduction->stream = stream;
+    reduction->stage = STAGE_WEAK_REDUCTION;
+    reduction->term = term;
+    reduction->walked = false;
+    reduction->status = OPTISCOPE_DONE;
+
+    run_guarded(reduction, translate_term);
+    source->deferred = deferred, source->exceeded = exceeded;
+
+    return reduction;
+}
+
+extern struct optiscope_reduction *
+optiscope_open_reduction(
+    FILE *const restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *const restrict term // must not be `NULL`
+) {
+    if (NULL == default_runtime) {
+        panic("The pools must be opened before running the algorithm!");
+    }
+
+    return optiscope_open_reduction_r(default_runtime, stream, term);
+}
+
+// Performe the stage-specific walk of `reduction->stage` if not done yet, &
+// then normalize the graph; returnes `false` if the fuel has run out.
+COMPILER_WARN_UNUSED_RESULT COMPILER_NONNULL(1, 2) //
+static bool
+run_stage(
+    struct optiscope_reduction *const restrict reduction,
+    void (*const callback)(struct context *const, const struct node),
+    const uint64_t phase,
+    const char *const walked_filename // if `NULL`, doe not draw the graph
+) {
+    MY_ASSERT(reduction);
+    MY_ASSERT(callback);
+
+    struct context *const graph = reduction->graph;
+
+    // The portable weak reduction loop might have spent the budget on its last
+    // interaction.
+    if (0 == graph->fuel) { return false; }
+
+    if (!reduction->walked) {
+        forget_active_pairs(graph);
+        graph->phase = phase;
+        graph->nsteps_to_walk = walk_graph(graph, callback);
+        if (walked_filename) { graphviz(graph, walked_filename); }
+        graph->phase = PHASE_REDUCE_FULLY;
+        reduction->walked = true;
+    }
+
+    if (!normalize_x_rules(graph)) { return false; }
+
+    reduction->walked = false;
+
+    return true;
+}
+
+// Run the stages of `reduction` until it is finished or the fuel runs out.
+COMPILER_NONNULL(1) //
+static void
+run_stages(struct optiscope_reduction *const restrict reduction) {
+    MY_ASSERT(reduction);
+
+    struct context *const graph = reduction->graph;
+
+    if (!refuel(graph)) { return; }
+
+    switch (reduction->stage) {
+    case STAGE_WEAK_REDUCTION:
+        // Phase #1: weak reduction.
         weak_reduction(graph);
+        if (!graph->time_to_stop) { return; }
         graphviz(graph, "target/1-weakly-reduced.dot");
-    }
 
-    if (NULL == stream) { goto finish; }
+        if (NULL == reduction->stream) {
+            reduction->stage = STAGE_FINISHED;
+            return;
+        }
 
 #define X(focus_name)                                                          \
-    graph->focus_name = alloc_focus(OPTISCOPE_MULTIFOCUS_COUNT);
-    CONTEXT_MULTIFOCUSES
+    graph->focus_name = alloc_focus(graph->runtime, OPTISCOPE_MULTIFOCUS_COUNT);
+        CONTEXT_MULTIFOCUSES
 #undef X
 
-    // Phase #2: full reduction.
-    {
-        graph->phase = PHASE_REDUCE_FULLY;
-        walk_graph(graph, normalize_delimiters_cb);
-        normalize_x_rules(graph);
+        compact_graph(graph);
+        reduction->stage = STAGE_FULL_REDUCTION;
+        // fallthrough
+    case STAGE_FULL_REDUCTION:
+        // Phase #2: full reduction. Weak reduction leaves active pairs all
+        // over the graph, whereas the read-back walks register the ones they
+        // create.
+        if (!run_stage(reduction, multifocus_cb, PHASE_REDUCE_FULLY, NULL)) {
+            return;
+        }
         graphviz(graph, "target/2-fully-reduced.dot");
-    }
 
-    // Phase #3: unwinding.
-    {
-        graph->phase = PHASE_UNWIND;
-        walk_graph(graph, unwind_cb);
-        graphviz(graph, "target/3-unwound.dot");
-        normalize_x_rules(graph);
+        compact_graph(graph);
+        reduction->stage = STAGE_UNWINDING;
+        // fallthrough
+    case STAGE_UNWINDING:
+        // Phase #3: unwinding.
+        if (!run_stage(
+                reduction, unwind_cb, PHASE_UNWIND, "target/3-unwound.dot")) {
+            return;
+        }
         graphviz(graph, "target/3-unwoundx.dot");
-    }
 
-    // Phase #4: scope removal.
-    {
-        graph->phase = PHASE_SCOPE_REMOVE;
-        walk_graph(graph, scope_remove_cb);
-        graphviz(graph, "target/4-unscoped.dot");
-        normalize_x_rules(graph);
+        reduction->stage = STAGE_SCOPE_REMOVAL;
+        // fallthrough
+    case STAGE_SCOPE_REMOVAL:
+        // Phase #4: scope removal.
+        if (!run_stage(
+                reduction,
+                scope_remove_cb,
+                PHASE_SCOPE_REMOVE,
+                "target/4-unscoped.dot")) {
+            return;
+        }
         graphviz(graph, "target/4-unscopedx.dot");
-    }
 
-    // Phase #5: loop cutting.
-    {
-        graph->phase = PHASE_LOOP_CUT;
-        walk_graph(graph, loop_cut_cb);
-        graphviz(graph, "target/5-unlooped.dot");
-        normalize_x_rules(graph);
+        reduction->stage = STAGE_LOOP_CUTTING;
+        // fallthrough
+    case STAGE_LOOP_CUTTING:
+        // Phase #5: loop cutting.
+        if (!run_stage(
+                reduction, loop_cut_cb, PHASE_LOOP_CUT, "target/5-unlooped.dot")) {
+            return;
+        }
         graphviz(graph, "target/5-unloopedx.dot");
+
+        MY_ASSERT(is_normalized_graph(graph));
+
+        to_lambda_string(
+            reduction->stream, 0, follow_port(&graph->root.ports[0]));
+
+        reduction->stage = STAGE_FINISHED;
+        // fallthrough
+    case STAGE_FINISHED: return;
+    default: COMPILER_UNREACHABLE();
     }
+}
+
+COMPILER_NONNULL(1) //
+extern enum optiscope_status
+optiscope_reduce_steps(
+    struct optiscope_reduction *const restrict reduction,
+    const uint64_t max_interactions) {
+    debug("%s(%" PRIu64 ")", __func__, max_interactions);
 
-    MY_ASSERT(is_normalized_graph(graph));
+    MY_ASSERT(reduction);
 
-    to_lambda_string(stream, 0, follow_port(&graph->root.ports[0]));
+    if (STAGE_FINISHED == reduction->stage) { return reduction->status; }
+    if (0 == max_interactions) { return OPTISCOPE_OUT_OF_FUEL; }
+
+    struct context *const graph = reduction->graph;
+
+    // The first portion is transferred to the fuel by `run_stages`.
+    graph->fuel = 0, graph->reserve = max_interactions;
+
+    run_guarded(reduction, run_stages);
+
+    return STAGE_FINISHED == reduction->stage ? reduction->status
+                                              : OPTISCOPE_OUT_OF_FUEL;
+}
+
+COMPILER_NONNULL(1) COMPILER_COLD //
+extern void
+optiscope_close_reduction(struct optiscope_reduction *const restrict reduction) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(reduction);
+
+    struct optiscope_runtime *const runtime = reduction->graph->runtime;
+
+    print_stats(reduction->graph);
+    free_context(reduction->graph);
+    free(reduction);
+
+    // Whatever nodes are still alive are unreachable by now.
+    if (0 == --runtime->nactive_runs) { reset_runtime(runtime); }
+}
+
+extern enum optiscope_status
+optiscope_algorithm_r(
+    struct optiscope_runtime *const restrict runtime, // must not be `NULL`
+    FILE *const restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *const restrict term // must not be `NULL`
+) {
+    debug("%s()", __func__);
+
+    MY_ASSERT(runtime);
+    MY_ASSERT(term);
+
+    struct optiscope_reduction *const reduction =
+        optiscope_open_reduction_r(runtime, stream, term);
+
+    enum optiscope_status status;
+    do {
+        status = optiscope_reduce_steps(reduction, UINT64_MAX);
+    } while (OPTISCOPE_OUT_OF_FUEL == status);
+
+    optiscope_close_reduction(reduction);
+
+    return status;
+}
+
+extern enum optiscope_status
+optiscope_algorithm(
+    FILE *const restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *const restrict term // must not be `NULL`
+) {
+    if (NULL == default_runtime) {
+        panic("The pools must be opened before running the algorithm!");
+    }
 
-finish:
-    print_stats(graph);
-    free_context(graph);
+    return optiscope_algorithm_r(default_runtime, stream, term);
 }
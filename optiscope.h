@@ -42,17 +42,40 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // - `OPTISCOPE_ENABLE_STEP_BY_STEP`
 //   Ask the user for ENTER before each interaction step.
 // - `OPTISCOPE_ENABLE_STATS`
-//   Enable run-time statistics (currently, onely the total numbers of specific
-//   interactions & non-interaction rewritings).
+//   Enable run-time statistics (currently, the total numbers of specific
+//   interactions & non-interaction rewritings, & the peak memory occupied by
+//   live nodes).
 // - `OPTISCOPE_ENABLE_GRAPHVIZ`
 //   Generate `target/state.dot(.svg)` before each interaction step (requires
 //   Graphviz).
 // - `OPTISCOPE_MULTIFOCUS_COUNT`
 //   The initiall number of nodes for the contiguous segment of multifocuses.
 //   Defaulting to 4096.
+// - `OPTISCOPE_POLL_INTERVAL`
+//   How many interactions (or steps of garbage collection & graph walks) to
+//   performe between checking for cancellation & timeouts. Defaulting to 4096.
+// - `OPTISCOPE_PREFETCH_DISTANCE`
+//   How many nodes ahead to prefetch while draining multifocuses (0 disables
+//   prefetching). Defaulting to 4, which is provisional (not yet tuned against
+//   cache miss counts).
 // - `OPTISCOPE_ENABLE_HUGE_PAGES`
 //   Use 2 MB huge pages for the memory pools (improves performance; requires
-//   Linux).
+//   Linux). Explicit huge pages are tried first, then transparent huge pages,
+//   then regular pages; the tier in use is reported in the statistics.
+// - `OPTISCOPE_ENABLE_THREADED_CODE`
+//   Run weak reduction as direct-threaded code via GNU C computed `goto`
+//   (experimental; no measurable gain so far; ignored by other compilers).
+// - `OPTISCOPE_ENABLE_BUMP_FIRST`
+//   Allocate nodes from the rest of the current chunk before reusing freed
+//   ones, which keepes the nodes of a redex close to each other (faster on
+//   some workloads, slower on others).
+// - `OPTISCOPE_DISABLE_LATE_GC`
+//   Collect garbage onely during weak reduction; later, the rejected subgraphs
+//   are just attached to erasers.
+// - `OPTISCOPE_ENABLE_COMPACTION`
+//   Relocate the graph into fresh memory in traversal order after weak
+//   reduction & before read-back, so that the later phases enjoy better
+//   locality.
 
 #if defined(OPTISCOPE_ENABLE_GRAPHVIZ) && defined(NDEBUG)
 #error `OPTISCOPE_ENABLE_GRAPHVIZ` is not compatible with `NDEBUG`!
@@ -66,6 +89,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define _DEFAULT_SOURCE
 #endif
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -130,9 +155,91 @@ perform(restrict LambdaTerm action, restrict LambdaTerm k);
 /// `k`.
 #define bind(x, action, k) apply(lambda((x), perform(var((x)), (k))), (action))
 
+/// A bump arena for lambda term objects. Building large terms from a builder
+/// is cheaper than allocating & deallocating each of their objects separately.
+typedef struct optiscope_term_builder *OptiscopeTermBuilder;
+
+/// Open a fresh term builder.
+extern OptiscopeTermBuilder
+optiscope_open_term_builder(void);
+
+/// Make the term constructors (`apply`, `lambda`, `var`, etc.) called by the
+/// current thread allocate from `builder`; if `NULL`, each term object is
+/// allocated separately, which is the default. Terms built either way can be
+/// freely mixed.
+extern void
+optiscope_use_term_builder(OptiscopeTermBuilder builder);
+
+/// Close the `builder`, releasing all the term objects allocated from it at
+/// once. Must not be called before the terms built from `builder` are
+/// translated, i.e., before `optiscope_algorithm` or `optiscope_open_reduction`
+/// returnes; the terms that are never run are released as well.
+extern void
+optiscope_close_term_builder(OptiscopeTermBuilder builder);
+
+/// The native functions that binary term images refer to by their indices, &
+/// textual terms by their names.
+struct optiscope_registry {
+    uint64_t (*const *unary_functions)(uint64_t);
+    size_t nunary_functions;
+    uint64_t (*const *binary_functions)(uint64_t, uint64_t);
+    size_t nbinary_functions;
+    /// The names of the functions, in the same order; either array (or any of
+    /// its names) may be `NULL`.
+    const char *const *unary_names;
+    const char *const *binary_names;
+};
+
+/// Write `term` to `stream` as a binary term image (see `README.md`), which
+/// can be loaded by `optiscope_load_term` later. Native functions are written
+/// as their indices in `registry`; all of them must be registered. The `term`
+/// object will be deallocated automatically. Returnes whether the image has
+/// been written & flushed successfully.
+extern bool
+optiscope_save_term(
+    FILE *restrict stream,
+    LambdaTerm term,
+    const struct optiscope_registry *restrict registry);
+
+/// Map the whole file behind `stream` (which must have been written by
+/// `optiscope_save_term`) into memory & check it. Returnes a term that is
+/// translated right from the mapped image when run, or `NULL` if the file
+/// cannot be mapped or is malformed. The `registry` must stay valid until the
+/// term is run, & must match the one the image was saved with. The `stream`
+/// can be closed afterwards.
+extern LambdaTerm
+optiscope_load_term(
+    FILE *restrict stream, const struct optiscope_registry *restrict registry);
+
+/// Parse a textual term (see `README.md` for the syntax) from `stream`, where
+/// native functions are referred to by their names in `registry`. The parsing
+/// is deferred until the term is run, & the graph nodes are built right as the
+/// parser goes, without allocating the lambda term objects; a syntax error is
+/// reported to `stderr`, & the algorithm returnes `OPTISCOPE_SYNTAX_ERROR`. The
+/// `stream` & the `registry` must stay valid until the term is run.
+extern LambdaTerm
+optiscope_parse_term(
+    FILE *restrict stream, const struct optiscope_registry *restrict registry);
+
+/// The outcome of running the algorithm.
+enum optiscope_status {
+    /// The term has been reduced (& read back, if requested).
+    OPTISCOPE_DONE,
+    /// The memory limit has been exceeded; the reduction has been abandoned.
+    OPTISCOPE_OUT_OF_MEMORY,
+    /// The interaction budget has been spent; the reduction can be resumed.
+    OPTISCOPE_OUT_OF_FUEL,
+    /// The reduction has been cancelled; it has been abandoned.
+    OPTISCOPE_CANCELLED,
+    /// The timeout has expired; the reduction has been abandoned.
+    OPTISCOPE_TIMED_OUT,
+    /// The textual term is malformed; the reduction has been abandoned.
+    OPTISCOPE_SYNTAX_ERROR,
+};
+
 /// Run the optimal reduction algorithm on the given `term`. The `term` object
 /// will be deallocated automatically.
-extern void
+extern enum optiscope_status
 optiscope_algorithm(
     FILE *restrict stream,            // if `NULL`, doe not read back
     struct lambda_term *restrict term // must not be `NULL`
@@ -146,6 +253,93 @@ optiscope_open_pools(void);
 extern void
 optiscope_close_pools(void);
 
+/// Limit the memory held by the pools & multifocuses to `nbytes` (zero means
+/// no limit). When a reduction needs more, it is abandoned & the algorithm
+/// returns `OPTISCOPE_OUT_OF_MEMORY` instead of growing further.
+extern void
+optiscope_set_memory_limit(size_t nbytes);
+
+/// Abandon each reduction that runs longer than `milliseconds` of wall-clock
+/// time (zero means no limit); the algorithm then returns
+/// `OPTISCOPE_TIMED_OUT`. For resumable reductions, the limit applies to each
+/// call of `optiscope_reduce_steps` separately.
+extern void
+optiscope_set_timeout(uint64_t milliseconds);
+
+/// Ask the reduction running on the global pools to stop as soon as possible &
+/// return `OPTISCOPE_CANCELLED`; can be called from any thread. If no
+/// reduction is running, the next one will be cancelled. Nested reductions
+/// (run by native functions) are cancelled together with the outer ones.
+extern void
+optiscope_cancel(void);
+
+/// An independent instance of the algorithm's memory (node pools &
+/// multifocuses). Reductions on distinct runtimes can proceed in parallel
+/// threads; a single runtime must not be used by two threads at once.
+typedef struct optiscope_runtime *OptiscopeRuntime;
+
+/// Open a fresh runtime.
+extern OptiscopeRuntime
+optiscope_open_runtime(void);
+
+/// Close the `runtime`, releasing all of its memory.
+extern void
+optiscope_close_runtime(OptiscopeRuntime runtime);
+
+/// Same as `optiscope_set_memory_limit`, but for the `runtime`.
+extern void
+optiscope_set_memory_limit_r(OptiscopeRuntime runtime, size_t nbytes);
+
+/// Same as `optiscope_set_timeout`, but for the `runtime`.
+extern void
+optiscope_set_timeout_r(OptiscopeRuntime runtime, uint64_t milliseconds);
+
+/// Same as `optiscope_cancel`, but for the `runtime`.
+extern void
+optiscope_cancel_r(OptiscopeRuntime runtime);
+
+/// Same as `optiscope_algorithm`, but allocate everything from the `runtime`
+/// instead of the global pools.
+extern enum optiscope_status
+optiscope_algorithm_r(
+    OptiscopeRuntime runtime,         // must not be `NULL`
+    FILE *restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *restrict term // must not be `NULL`
+);
+
+/// A reduction that can be performed in several slices, so that a single term
+/// cannot monopolise the thread running it.
+typedef struct optiscope_reduction *OptiscopeReduction;
+
+/// Prepare the reduction of `term` on the global pools, without performing any
+/// interaction yet. The `term` object will be deallocated automatically.
+extern OptiscopeReduction
+optiscope_open_reduction(
+    FILE *restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *restrict term // must not be `NULL`
+);
+
+/// Same as `optiscope_open_reduction`, but allocate everything from the
+/// `runtime`.
+extern OptiscopeReduction
+optiscope_open_reduction_r(
+    OptiscopeRuntime runtime,         // must not be `NULL`
+    FILE *restrict stream,            // if `NULL`, doe not read back
+    struct lambda_term *restrict term // must not be `NULL`
+);
+
+/// Continue the `reduction` for about `max_interactions` interactions. Returnes
+/// `OPTISCOPE_OUT_OF_FUEL` if it is not complete yet, in which case it can be
+/// resumed by calling this function again; otherwise, returnes the final
+/// status (every time it is called). The reduction stops exactly at the
+/// budget, though the graph walks between the phases are not counted.
+extern enum optiscope_status
+optiscope_reduce_steps(OptiscopeReduction reduction, uint64_t max_interactions);
+
+/// Release the `reduction`, whether complete or not.
+extern void
+optiscope_close_reduction(OptiscopeReduction reduction);
+
 /// Redirect all characters from the `source` file stream to the `destination`
 /// file stream.
 extern void
@@ -1,6 +1,7 @@
 #include "optiscope.h"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,29 +11,16 @@
 
 static int exit_code = EXIT_SUCCESS;
 
-#define TEST_CASE(f, expected) test_case(#f, f, expected)
-
+// Compare the read-back contents of `fp` with `expected` & close `fp`.
 static void
-test_case(
+check_output(
     const char test_case_name[const restrict],
-    struct lambda_term *(*f)(void),
+    FILE *const restrict fp,
     const char expected[const restrict]) {
-    assert(f);
+    assert(fp);
     assert(expected);
     assert(strlen(expected) > 0);
 
-    printf("Testing '%s'...\n", test_case_name);
-
-    FILE *const fp = tmpfile();
-    if (NULL == fp) {
-        perror("tmpfile");
-        return;
-    }
-
-    optiscope_open_pools();
-    optiscope_algorithm(fp, f());
-    optiscope_close_pools();
-
     rewind(fp);
     for (size_t i = 0; i < strlen(expected); i++) {
         int c;
@@ -61,6 +49,314 @@ close_fp:
     if (0 != fclose(fp)) { perror("fclose"); }
 }
 
+#define TEST_CASE(f, expected) test_case(#f, f, expected)
+
+static void
+test_case(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    const char expected[const restrict]) {
+    assert(f);
+
+    printf("Testing '%s'...\n", test_case_name);
+
+    FILE *const fp = tmpfile();
+    if (NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+
+    optiscope_open_pools();
+    // Reduce the term twice to check that the pools are properly reused.
+    optiscope_algorithm(NULL, f());
+    optiscope_algorithm(fp, f());
+    optiscope_close_pools();
+
+    check_output(test_case_name, fp, expected);
+}
+
+#define TEST_FUEL(f, max_interactions, expected)                               \
+    test_fuel(#f, f, max_interactions, expected)
+
+static void
+test_fuel(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    const uint64_t max_interactions,
+    const char expected[const restrict]) {
+    assert(f);
+
+    printf(
+        "Testing '%s' with %" PRIu64 " interactions per slice...\n",
+        test_case_name,
+        max_interactions);
+
+    FILE *const fp = tmpfile();
+    if (NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+
+    optiscope_open_pools();
+    const OptiscopeReduction reduction = optiscope_open_reduction(fp, f());
+    enum optiscope_status status;
+    uint64_t nslices = 0;
+    do {
+        status = optiscope_reduce_steps(reduction, max_interactions);
+        nslices++;
+    } while (OPTISCOPE_OUT_OF_FUEL == status);
+    optiscope_close_reduction(reduction);
+    optiscope_close_pools();
+
+    if (OPTISCOPE_DONE != status || nslices < 2) {
+        fprintf(stderr, "FAILED:\n    %s\n", test_case_name);
+        fprintf(
+            stderr,
+            "Received status %d after %" PRIu64 " slices.\n",
+            status,
+            nslices);
+        exit_code = EXIT_FAILURE;
+        if (0 != fclose(fp)) { perror("fclose"); }
+        return;
+    }
+
+    check_output(test_case_name, fp, expected);
+}
+
+#define TEST_BUILDER(f, expected) test_builder(#f, f, expected)
+
+static void
+test_builder(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    const char expected[const restrict]) {
+    assert(f);
+
+    printf("Testing '%s' with a term builder...\n", test_case_name);
+
+    FILE *const fp = tmpfile();
+    if (NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+
+    const OptiscopeTermBuilder builder = optiscope_open_term_builder();
+    optiscope_use_term_builder(builder);
+    struct lambda_term *const term = f();
+    // This term is never run; it must be released by closing the builder.
+    (void)f();
+    optiscope_use_term_builder(NULL);
+
+    // Mix the built term with a separately allocated redex.
+    struct lambda_term *x;
+    optiscope_open_pools();
+    optiscope_algorithm(fp, apply(lambda(x, var(x)), term));
+    optiscope_close_pools();
+    optiscope_close_term_builder(builder);
+
+    check_output(test_case_name, fp, expected);
+}
+
+#define TEST_IMAGE(f, registry, expected)                                      \
+    test_image(#f, f, registry, expected)
+
+static void
+test_image(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    const struct optiscope_registry *const restrict registry,
+    const char expected[const restrict]) {
+    assert(f);
+    assert(registry);
+
+    printf("Testing '%s' through a binary term image...\n", test_case_name);
+
+    FILE *const image = tmpfile(), *const fp = tmpfile();
+    if (NULL == image || NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+
+    struct lambda_term *term = NULL;
+    if (optiscope_save_term(image, f(), registry)) {
+        term = optiscope_load_term(image, registry);
+    }
+    if (0 != fclose(image)) { perror("fclose"); }
+
+    if (NULL == term) {
+        fprintf(stderr, "FAILED:\n    %s\n", test_case_name);
+        fprintf(stderr, "Cannot save or load the image.\n");
+        exit_code = EXIT_FAILURE;
+        if (0 != fclose(fp)) { perror("fclose"); }
+        return;
+    }
+
+    // Embed the loaded term into a separately built redex.
+    struct lambda_term *x;
+    optiscope_open_pools();
+    optiscope_algorithm(fp, apply(lambda(x, var(x)), term));
+    optiscope_close_pools();
+
+    check_output(test_case_name, fp, expected);
+}
+
+#define TEST_SOURCE(name, source, registry, expected)                          \
+    test_source(#name, source, registry, expected)
+
+// If `expected` is `NULL`, `source` must be rejected as malformed.
+static void
+test_source(
+    const char test_case_name[const restrict],
+    const char source[const restrict],
+    const struct optiscope_registry *const restrict registry,
+    const char *const restrict expected) {
+    assert(source);
+    assert(registry);
+
+    printf("Testing '%s' as a textual term...\n", test_case_name);
+
+    FILE *const input = tmpfile(), *const fp = tmpfile();
+    if (NULL == input || NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+    if (EOF == fputs(source, input)) { perror("fputs"); }
+    rewind(input);
+
+    optiscope_open_pools();
+    const enum optiscope_status status = optiscope_algorithm(
+        expected ? fp : NULL, optiscope_parse_term(input, registry));
+    optiscope_close_pools();
+    if (0 != fclose(input)) { perror("fclose"); }
+
+    if (NULL == expected) {
+        if (0 != fclose(fp)) { perror("fclose"); }
+        if (OPTISCOPE_SYNTAX_ERROR != status) {
+            fprintf(stderr, "FAILED:\n    %s\n", test_case_name);
+            fprintf(stderr, "Expected a syntax error, received %d.\n", status);
+            exit_code = EXIT_FAILURE;
+            return;
+        }
+        printf("Good: %s\n", test_case_name);
+        return;
+    }
+
+    check_output(test_case_name, fp, expected);
+}
+
+#define TEST_STATUS(f, nbytes, milliseconds, expected)                         \
+    test_status(#f, f, nbytes, milliseconds, expected)
+#define TEST_MEMORY_LIMIT(f, nbytes, expected)                                 \
+    TEST_STATUS(f, nbytes, 0, expected)
+#define TEST_TIMEOUT(f, milliseconds, expected)                                \
+    TEST_STATUS(f, 0, milliseconds, expected)
+
+static void
+test_status(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    const size_t nbytes,
+    const uint64_t milliseconds,
+    const enum optiscope_status expected) {
+    assert(f);
+
+    printf(
+        "Testing '%s' with %zu bytes of memory & %" PRIu64 " ms of time...\n",
+        test_case_name,
+        nbytes,
+        milliseconds);
+
+    optiscope_open_pools();
+    optiscope_set_memory_limit(nbytes);
+    optiscope_set_timeout(milliseconds);
+    const enum optiscope_status status = optiscope_algorithm(NULL, f());
+    optiscope_set_timeout(0);
+    optiscope_set_memory_limit(0);
+    optiscope_close_pools();
+
+    if (status != expected) {
+        fprintf(stderr, "FAILED:\n    %s\n", test_case_name);
+        fprintf(stderr, "Expected status %d, received %d.\n", expected, status);
+        exit_code = EXIT_FAILURE;
+        return;
+    }
+
+    printf("Good: %s\n", test_case_name);
+}
+
+#define TEST_RUNTIMES(f, expected)                                             \
+    test_runtimes(#f, f, endless_loop_test, expected)
+
+// Check that the memory limit of one runtime & the cancellation of another
+// stay with their own runtimes, then interleave the reductions of `f` on both.
+// `endless` must loop forever in constant memory.
+static void
+test_runtimes(
+    const char test_case_name[const restrict],
+    struct lambda_term *(*f)(void),
+    struct lambda_term *(*endless)(void),
+    const char expected[const restrict]) {
+    assert(f);
+    assert(endless);
+
+    printf("Testing '%s' on two runtimes...\n", test_case_name);
+
+    FILE *const fp = tmpfile();
+    if (NULL == fp) {
+        perror("tmpfile");
+        return;
+    }
+
+    const OptiscopeRuntime first = optiscope_open_runtime(),
+                           second = optiscope_open_runtime();
+
+    optiscope_set_memory_limit_r(first, 1);
+    optiscope_cancel_r(second);
+    const enum optiscope_status starved =
+        optiscope_algorithm_r(first, NULL, f());
+    const enum optiscope_status cancelled =
+        optiscope_algorithm_r(second, NULL, endless());
+    // The cancellation is over, & the limit of `first` is not shared.
+    const enum optiscope_status unaffected =
+        optiscope_algorithm_r(second, NULL, f());
+    optiscope_set_memory_limit_r(first, 0);
+
+    const OptiscopeReduction
+        first_reduction = optiscope_open_reduction_r(first, fp, f()),
+        second_reduction = optiscope_open_reduction_r(second, NULL, f());
+    enum optiscope_status first_status, second_status;
+    do {
+        first_status = optiscope_reduce_steps(first_reduction, 1000);
+        second_status = optiscope_reduce_steps(second_reduction, 1000);
+    } while (OPTISCOPE_OUT_OF_FUEL == first_status ||
+             OPTISCOPE_OUT_OF_FUEL == second_status);
+    optiscope_close_reduction(first_reduction);
+    optiscope_close_reduction(second_reduction);
+
+    optiscope_close_runtime(first);
+    optiscope_close_runtime(second);
+
+    if (OPTISCOPE_OUT_OF_MEMORY != starved ||
+        OPTISCOPE_CANCELLED != cancelled || OPTISCOPE_DONE != unaffected ||
+        OPTISCOPE_DONE != first_status || OPTISCOPE_DONE != second_status) {
+        fprintf(stderr, "FAILED:\n    %s\n", test_case_name);
+        fprintf(
+            stderr,
+            "Received statuses %d (limited), %d (cancelled), %d (unaffected), "
+            "%d & %d (interleaved).\n",
+            starved,
+            cancelled,
+            unaffected,
+            first_status,
+            second_status);
+        exit_code = EXIT_FAILURE;
+        if (0 != fclose(fp)) { perror("fclose"); }
+        return;
+    }
+
+    check_output(test_case_name, fp, expected);
+}
+
 // The S, K, I combinators
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
@@ -1242,6 +1538,68 @@ fix_ackermann_test(void) {
     return apply(apply(fix_ackermann(), cell(3)), cell(3));
 }
 
+// Endless loops
+// @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+
+// Counts upwards forever in constant memory.
+static struct lambda_term *
+endless_loop_test(void) {
+    struct lambda_term *rec, *n;
+
+    return apply(
+        fix(lambda(
+            rec,
+            lambda(
+                n,
+                perform(
+                    var(n), apply(var(rec), unary_call(plus_one, var(n))))))),
+        cell(0));
+}
+
+static uint64_t
+cancel_reduction(const uint64_t x) {
+    optiscope_cancel();
+    return x;
+}
+
+static struct lambda_term *
+cancelled_endless_loop_test(void) {
+    struct lambda_term *x;
+
+    return apply(
+        lambda(x, perform(var(x), endless_loop_test())),
+        unary_call(cancel_reduction, cell(0)));
+}
+
+// Runs `cancelled_endless_loop_test` as a nested reduction, whose cancellation
+// must be observed by the outer reduction as well.
+static uint64_t
+run_cancelled_reduction(const uint64_t x) {
+    (void)optiscope_algorithm(NULL, cancelled_endless_loop_test());
+    return x;
+}
+
+static struct lambda_term *
+nested_cancelled_endless_loop_test(void) {
+    struct lambda_term *x;
+
+    return apply(
+        lambda(x, perform(var(x), endless_loop_test())),
+        unary_call(run_cancelled_reduction, cell(0)));
+}
+
+// Sums up the numbers from 1 to 10000 by a long chain of native calls, whose
+// translation alone exceeds a small memory limit.
+static struct lambda_term *
+long_sum_test(void) {
+    struct lambda_term *sum = cell(0);
+    for (uint64_t i = 1; i <= 10000; i++) {
+        sum = binary_call(add, sum, cell(i));
+    }
+
+    return sum;
+}
+
 // Examples from the literature
 // @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
 
@@ -1317,6 +1675,73 @@ wadsworth_counterexample(void) { // Asperti & Guerrini
 
 #ifndef OPTISCOPE_TESTS_NO_MAIN
 
+static uint64_t (*const unary_functions[])(uint64_t) = {
+    square,
+    cube,
+    halve,
+    is_zero,
+    is_one,
+    plus_one,
+    minus_one,
+    cancel_reduction,
+};
+
+static uint64_t (*const binary_functions[])(uint64_t, uint64_t) = {
+    add,
+    multiply,
+    subtract,
+    divide,
+    equals,
+    less_than_or_equal,
+    concatenate_ints,
+    less_than,
+    greater_than_or_equal,
+};
+
+static const char *const unary_names[] = {
+    "square",
+    "cube",
+    "halve",
+    "is_zero",
+    "is_one",
+    "plus_one",
+    "minus_one",
+    NULL, // `cancel_reduction` is not for textual terms
+};
+
+static const char *const binary_names[] = {
+    "add",
+    "multiply",
+    "subtract",
+    "divide",
+    "equals",
+    "less_than_or_equal",
+    "concatenate_ints",
+    "less_than",
+    "greater_than_or_equal",
+};
+
+static const struct optiscope_registry registry = {
+    .unary_functions = unary_functions,
+    .nunary_functions = sizeof unary_functions / sizeof unary_functions[0],
+    .binary_functions = binary_functions,
+    .nbinary_functions = sizeof binary_functions / sizeof binary_functions[0],
+    .unary_names = unary_names,
+    .binary_names = binary_names,
+};
+
+static const char fibonacci_source[] =
+    "# The Fibonacci numbers by a fixpoint.\n"
+    "let fib = fix \\rec n.\n"
+    "    if less_than n 2 then n\n"
+    "    else add (rec (minus_one n)) (rec (subtract n 2))\n"
+    "in fib 10\n";
+
+static const char church_source[] =
+    "let two = λf x. f (f x) in\n"
+    "let x = two in # shadowed by the lambda below\n"
+    "(\\x. x x) x\n";
+
 int
 main(void) {
     puts("Running the test cases...");
@@ -1367,6 +1792,34 @@ main(void) {
     TEST_CASE(asperti_guerrini_example, "(λ (0 0))");
     TEST_CASE(wadsworth_example, "(λ (0 0))");
     TEST_CASE(wadsworth_counterexample, "(λ (λ (1 0)))");
+    TEST_CASE(long_sum_test, "cell[50005000]");
+
+    TEST_FUEL(scott_insertion_sort_test, 1000, "cell[113450]");
+    TEST_FUEL(wadsworth_counterexample, 1, "(λ (λ (1 0)))");
+
+    TEST_BUILDER(scott_quicksort_test, "cell[12347890]");
+    TEST_BUILDER(wadsworth_counterexample, "(λ (λ (1 0)))");
+
+    TEST_IMAGE(scott_quicksort_test, &registry, "cell[12347890]");
+    TEST_IMAGE(lamping_example, &registry, "(λ 0)");
+    TEST_IMAGE(bcw_test, &registry, "(λ (λ (λ ((2 0) (1 0)))))");
+
+    TEST_SOURCE(fibonacci_source, fibonacci_source, &registry, "cell[55]");
+    TEST_SOURCE(
+        church_source, church_source, &registry, "(λ (λ (1 (1 (1 (1 0))))))");
+    TEST_SOURCE(unbalanced_source, "(\\x. x", &registry, NULL);
+    TEST_SOURCE(unbound_source, "\\x. y", &registry, NULL);
+    TEST_SOURCE(partial_primitive_source, "add 1", &registry, NULL);
+
+    TEST_MEMORY_LIMIT(skk_test, 1024 * 1024, OPTISCOPE_DONE);
+    TEST_MEMORY_LIMIT(fix_ackermann_test, 1024 * 1024, OPTISCOPE_OUT_OF_MEMORY);
+    TEST_MEMORY_LIMIT(skk_test, 1, OPTISCOPE_OUT_OF_MEMORY);
+    TEST_MEMORY_LIMIT(long_sum_test, 256 * 1024, OPTISCOPE_OUT_OF_MEMORY);
+    TEST_TIMEOUT(endless_loop_test, 100, OPTISCOPE_TIMED_OUT);
+    TEST_TIMEOUT(cancelled_endless_loop_test, 0, OPTISCOPE_CANCELLED);
+    TEST_TIMEOUT(nested_cancelled_endless_loop_test, 1000, OPTISCOPE_CANCELLED);
+
+    TEST_RUNTIMES(scott_insertion_sort_test, "cell[113450]");
 
     return exit_code;
 }